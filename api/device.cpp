@@ -94,7 +94,7 @@ std::string &uxdevice::surface_area_t::operator[](
     std::shared_ptr<std::string> _val) noexcept {
   auto n = mapped_objects.find(reinterpret_cast<std::size_t>(_val.get()));
   if (n != mapped_objects.end())
-    n->second->changed();
+    state_changed(n->second);
   return *_val;
 }
 
@@ -116,7 +116,7 @@ void surface_area_t::set_surface_defaults(void) { SYSTEM_DEFAULTS }
  * @internal
  * @fn render_loop(void)
  * @details The routine is the main rendering thread. The thread runs when
- * necessary based upon a condition variable. Locks are placed on the surface
+ * necessary based upon a wake event. Locks are placed on the surface
  * and rectangle list. The surface may change due to user resizing the gui
  * window so a spin flag is used to accommodate the functionality. That is
  * drawing cannot occur on the graphic device while the surface is being
@@ -133,8 +133,7 @@ void surface_area_t::set_surface_defaults(void) { SYSTEM_DEFAULTS }
  * values that must instantiate a redraw of the object. The hash_code() function
  * is used to detect changes.
  *
- * If no work exists, the surface_prime waits on the cvRenderWork condition
- * variable.
+ * If no work exists, the surface_prime waits on the render_work_wake event.
  */
 void uxdevice::surface_area_t::render_loop(void) {
   while (bProcessing) {
@@ -149,6 +148,87 @@ void uxdevice::surface_area_t::render_loop(void) {
   }
 }
 
+/**
+ * @internal
+ * @fn reactor_loop(void)
+ * @details The routine is the single thread form of the message loop, the
+ * event dispatcher and render_loop. One epoll wait covers the xcb
+ * connection, the render_work_wake event and a frame timer. Messages are
+ * dispatched as soon as they are read. Render work arms the timer for the
+ * next frame time, at most one frame per frame_interval, or for the time an
+ * interactive resize settles. The frame is rendered when the timer fires.
+ */
+void uxdevice::surface_area_t::reactor_loop(void) {
+  event_reactor_t reactor = {};
+  std::chrono::steady_clock::time_point last_frame = {};
+  bool frame_armed = false;
+
+  auto frame_schedule = [&]() {
+    if (frame_armed)
+      return;
+
+    std::optional<std::chrono::steady_clock::time_point> due = {};
+    if (context->state())
+      due = std::max(last_frame + frame_interval,
+                     std::chrono::steady_clock::now());
+
+    auto settle = window_manager->surface_settle_due();
+    if (settle && (!due || *settle < *due))
+      due = settle;
+
+    if (!due)
+      return;
+
+    reactor.timer_arm(*due);
+    frame_armed = true;
+  };
+
+  window_manager->reactor_attach(reactor);
+
+  reactor.watch(context->render_work_wake.native_handle(), [&]() {
+    context->render_work_wake.consume();
+    frame_schedule();
+  });
+
+  reactor.timer([&]() {
+    bool bSurface = false;
+    frame_armed = false;
+
+    window_manager->surface_fn(
+        [&](auto surface) { bSurface = surface != nullptr; });
+    if (!bSurface)
+      return;
+
+    context->render();
+    last_frame = std::chrono::steady_clock::now();
+
+    if (error_check()) {
+      std::string errors = error_text();
+      error_clear();
+      cout << errors << std::flush;
+    }
+
+    frame_schedule();
+  });
+
+  /// @brief xcb may read events into its queue while waiting for a reply.
+  /// Those are not reported by the descriptor so they are taken before each
+  /// wait.
+  reactor.run([&]() {
+    if (!bProcessing) {
+      reactor.stop();
+      return;
+    }
+
+    window_manager->dispatch_available(false);
+
+    /// @brief work queued by the events, such as an expose, must have a
+    /// frame armed or a wake pending before the loop blocks.
+    assert(!context->state() || frame_armed ||
+           context->render_work_wake.pending());
+  });
+}
+
 /**
  * @internal
  * @fn dispatch_event
@@ -158,11 +238,16 @@ void uxdevice::surface_area_t::render_loop(void) {
  */
 void uxdevice::surface_area_t::dispatch_event(const event_t &evt) {
 
-  if (evt.type == std::type_index(typeid(listen_paint_t)))
+  if (evt.type == event_id_t::paint)
     context->state_surface(evt.x, evt.y, evt.w, evt.h);
-  else if (evt.type == std::type_index(typeid(listen_resize_t)))
+  else if (evt.type == event_id_t::resize)
     context->resize_surface(evt.w, evt.h);
 
+  auto handlers = get_event_vector(evt.type);
+  if (handlers)
+    for (auto &fn : *handlers)
+      fn(evt);
+
   if (fnEvents)
     fnEvents(evt);
 }
@@ -181,6 +266,19 @@ void uxdevice::surface_area_t::start_processing(void) {
   event_handler_t ev = std::bind(&uxdevice::surface_area_t::dispatch_event,
                                  this, std::placeholders::_1);
   context->cache_threshold = 2000;
+
+  if (window_manager->threading == message_threading_t::reactor) {
+    std::thread thrReactor([=]() {
+      bProcessing = true;
+      reactor_loop();
+    });
+
+    thrReactor.detach();
+    return;
+  }
+
+  window_manager->start_threads();
+
   std::thread thrRenderer([=]() {
     bProcessing = true;
     render_loop();
@@ -191,32 +289,35 @@ void uxdevice::surface_area_t::start_processing(void) {
 
 /**
  * @internal
- * @fn get_event_vector(eventType evtType)
- * @brief The function maps the event id to the appropriate vector. This is kept
- * statically here for retext_color_t management.
- * @param eventType evtType
- */
-std::list<event_handler_t> &
-uxdevice::surface_area_t::get_event_vector(std::type_index evtType) {
-  static std::unordered_map<std::type_index, std::list<event_handler_t> &>
-      eventTypeMap = {
-          {std::type_index(typeid(listen_focus_t)), onfocus},
-          {std::type_index(typeid(listen_blur_t)), onblur},
-          {std::type_index(typeid(listen_resize_t)), onresize},
-          {std::type_index(typeid(listen_keydown_t)), onkeydown},
-          {std::type_index(typeid(listen_keyup_t)), onkeyup},
-          {std::type_index(typeid(listen_keypress_t)), onkeypress},
-          {std::type_index(typeid(listen_mouseenter_t)), onmouseenter},
-          {std::type_index(typeid(listen_mouseleave_t)), onmouseleave},
-          {std::type_index(typeid(listen_mousemove_t)), onmousemove},
-          {std::type_index(typeid(listen_mousedown_t)), onmousedown},
-          {std::type_index(typeid(listen_mouseup_t)), onmouseup},
-          {std::type_index(typeid(listen_click_t)), onclick},
-          {std::type_index(typeid(listen_dblclick_t)), ondblclick},
-          {std::type_index(typeid(listen_contextmenu_t)), oncontextmenu},
-          {std::type_index(typeid(listen_wheel_t)), onwheel}};
-  auto it = eventTypeMap.find(evtType);
-  return it->second;
+ * @fn get_event_vector
+ * @param const event_id_t id
+ * @brief The function maps the event id to the appropriate vector. The id is
+ * the index.
+ */
+std::shared_ptr<const uxdevice::surface_area_t::event_handlers_t>
+uxdevice::surface_area_t::get_event_vector(const event_id_t id) {
+  return std::atomic_load(&listeners[static_cast<std::size_t>(id)]);
+}
+
+/**
+ * @internal
+ * @fn listen
+ * @param const event_id_t id
+ * @param const event_handler_t &fn
+ * @brief adds the handler of a listener inserted within the stream. The list
+ * is copied with the handler added and then published.
+ */
+void uxdevice::surface_area_t::listen(const event_id_t id,
+                                      const event_handler_t &fn) {
+  std::lock_guard lock(listeners_mutex);
+  auto &slot = listeners[static_cast<std::size_t>(id)];
+  auto current = std::atomic_load(&slot);
+
+  auto next = current ? std::make_shared<event_handlers_t>(*current)
+                      : std::make_shared<event_handlers_t>();
+  next->emplace_back(fn);
+  std::atomic_store(&slot,
+                    std::shared_ptr<const event_handlers_t>(std::move(next)));
 }
 
 #if 0
@@ -260,9 +361,39 @@ void uxdevice::surface_area_t::clear(void) {
  * issues or more informative cpu usage since the data perception is changed.
  */
 void uxdevice::surface_area_t::notify_complete(void) {
+  changes_commit();
   context->state_notify_complete();
 }
 
+/**
+ * @fn batch_begin(void)
+ * @brief units streamed in until the matching batch_commit are inserted
+ * without taking the display list and viewport locks for each one. The
+ * renderer sees them all at commit. Calls may be nested.
+ */
+uxdevice::surface_area_t &uxdevice::surface_area_t::batch_begin(void) {
+  if (batch_depth++ == 0) {
+    display_list_batch_begin();
+    context->batch_begin();
+  }
+  return *this;
+}
+
+/**
+ * @fn batch_commit(void)
+ * @brief publishes the units of the outermost batch, queues one merged paint
+ * region and notifies the renderer once.
+ */
+uxdevice::surface_area_t &uxdevice::surface_area_t::batch_commit(void) {
+  if (batch_depth == 0 || --batch_depth != 0)
+    return *this;
+
+  changes_commit();
+  display_list_batch_commit();
+  context->batch_commit();
+  return *this;
+}
+
 /**
  * @internal
  * @fn maintain_index
@@ -280,6 +411,51 @@ void uxdevice::surface_area_t::maintain_index(
   return;
 }
 
+/**
+ * @internal
+ * @fn state_changed
+ * @param const std::shared_ptr<display_unit_t> obj
+ * @brief records an indexed unit handed to the caller for change. Nothing is
+ * marked or queued for render here since the caller has not changed the unit
+ * yet. An earlier unit outside of a batch is complete by this time and is
+ * committed and notified first.
+ */
+void uxdevice::surface_area_t::state_changed(
+    const std::shared_ptr<display_unit_t> obj) {
+  if (batch_depth == 0 && !changes_pending.empty()) {
+    changes_commit();
+    context->state_notify_complete();
+  }
+
+  changes_pending.insert(obj);
+}
+
+/**
+ * @internal
+ * @fn changes_commit
+ * @brief the changes made through the references returned by operator[] and
+ * get<T>() are complete. The hash generations of the units advance now so a
+ * hash the renderer took while the change was being made is not kept for the
+ * changed unit. The visuals that linked a unit are marked through the display
+ * context dependency index and a visual changed directly queues its own area.
+ * Called from notify_complete(), the outermost batch_commit() and the next
+ * indexed access, by which time the caller's edit is done. The caller
+ * notifies the renderer.
+ */
+void uxdevice::surface_area_t::changes_commit(void) {
+  for (auto &obj : changes_pending) {
+    obj->changed();
+    context->state_dependents(obj.get());
+
+    if (auto visual = std::dynamic_pointer_cast<display_visual_t>(obj)) {
+      visual->changed();
+      context->state(visual);
+    }
+  }
+
+  changes_pending.clear();
+}
+
 /**
  * @internal
  * @overload
@@ -294,7 +470,22 @@ void uxdevice::surface_area_t::maintain_index(
  * is also added.
  */
 surface_area_t &uxdevice::surface_area_t::stream_input(const std::string &s) {
-  in(text_data_t{s}, textual_render_t{});
+  adopt(text_data_t{s});
+  in(textual_render_t{});
+  return *this;
+}
+
+/**
+ * @internal
+ * @overload
+ * @fn stream input
+ * @param std::string &&s
+ * @brief the caller's string is moved into the text_data_t unit. Neither the
+ * unit nor its text is copied.
+ */
+surface_area_t &uxdevice::surface_area_t::stream_input(std::string &&s) {
+  adopt(text_data_t{std::move(s)});
+  in(textual_render_t{});
   return *this;
 }
 
@@ -338,8 +529,7 @@ surface_area_t &uxdevice::surface_area_t::stream_input(
  */
 surface_area_t &
 uxdevice::surface_area_t::stream_input(const std::stringstream &_val) {
-  in(text_data_t{_val.str()}, textual_render_t{});
-  return *this;
+  return stream_input(_val.str());
 }
 
 /**
@@ -394,6 +584,108 @@ surface_area_t &uxdevice::surface_area_t::stream_input(
   return *this;
 }
 
+/**
+ * @overload
+ * @internal
+ * @fn stream input
+ * @param const text_source_t &_val
+ * @brief inserting a reference copies the text at the time of insertion.
+ */
+surface_area_t &
+uxdevice::surface_area_t::stream_input(const text_source_t &_val) {
+  return stream_input(_val.str());
+}
+
+/**
+ * @overload
+ * @internal
+ * @fn stream input
+ * @param const std::shared_ptr<text_source_t> _val
+ * @brief the source is shared with the caller. Edits made through append or
+ * replace advance its version which is detected at render time without
+ * reading the text.
+ */
+surface_area_t &uxdevice::surface_area_t::stream_input(
+    const std::shared_ptr<text_source_t> _val) {
+  in(text_data_t{_val}.index(reinterpret_cast<std::size_t>(_val.get())),
+     textual_render_t{});
+  return *this;
+}
+
+/**
+ * @overload
+ * @internal
+ * @fn stream input
+ * @param const text_span_t &_val
+ * @brief the text is not copied. The span's owner token is held by the unit
+ * which keeps the caller's bytes alive.
+ */
+surface_area_t &
+uxdevice::surface_area_t::stream_input(const text_span_t &_val) {
+  adopt(text_data_t{text_data_storage_t{_val}});
+  in(textual_render_t{});
+  return *this;
+}
+
+/**
+ * @overload
+ * @internal
+ * @fn stream input
+ * @param const std::shared_ptr<text_span_t> _val
+ * @brief the span itself is small and is copied. The caller's bytes are
+ * not.
+ */
+surface_area_t &uxdevice::surface_area_t::stream_input(
+    const std::shared_ptr<text_span_t> _val) {
+  return stream_input(*_val);
+}
+
+/**
+ * @overload
+ * @internal
+ * @fn stream input
+ * @param const text_number_t &_val
+ * @brief the number is copied and owned by the system. Insert a shared
+ * pointer to keep the ability to set it.
+ */
+surface_area_t &
+uxdevice::surface_area_t::stream_input(const text_number_t &_val) {
+  return stream_input(std::make_shared<text_number_t>(_val));
+}
+
+/**
+ * @overload
+ * @internal
+ * @fn stream input
+ * @param const std::shared_ptr<text_number_t> _val
+ * @brief the number is shared with the caller and may be set from any thread.
+ * A change of its text marks the visuals that show it and wakes the
+ * renderer. The surface and unit are held weakly so a number that outlives
+ * them is harmless.
+ */
+surface_area_t &uxdevice::surface_area_t::stream_input(
+    const std::shared_ptr<text_number_t> _val) {
+  auto data = std::allocate_shared<text_data_t>(
+      unit_allocator_t<text_data_t>(display_list_arena),
+      text_data_storage_t{_val});
+  data->index(reinterpret_cast<std::size_t>(_val.get()));
+  insert_unit(data, false);
+  in(textual_render_t{});
+
+  std::weak_ptr<display_context_t> wcontext = context;
+  std::weak_ptr<text_data_t> wdata = data;
+  _val->changed([wcontext, wdata]() {
+    auto c = wcontext.lock();
+    auto d = wdata.lock();
+    if (!c || !d)
+      return;
+    d->hash_invalidate();
+    c->state_dependents(d.get());
+    c->state_notify_complete();
+  });
+  return *this;
+}
+
 /**
  * @fn save
  * @brief
@@ -640,6 +932,33 @@ surface_area_t &uxdevice::surface_area_t::user_distance(double &x, double &y) {
   return *this;
 }
 
+/**
+ * @fn hit_test
+ * @param double x
+ * @param double y
+ * @brief the visual is found by its ink rectangle within the display
+ * context's hit index.
+ * @return std::shared_ptr<display_visual_t> - empty when nothing is hit.
+ */
+std::shared_ptr<display_visual_t>
+uxdevice::surface_area_t::hit_test(double x, double y) {
+  return context->hit_test(x, y);
+}
+
+/**
+ * @fn hit_test
+ * @overload
+ * @param const hit_refine_t &refine
+ * @brief refine is asked about each visual whose ink rectangle holds the
+ * point, from the top. It may test the exact shape, such as with in_fill or
+ * in_stroke after forming the path.
+ */
+std::shared_ptr<display_visual_t>
+uxdevice::surface_area_t::hit_test(double x, double y,
+                                   const hit_refine_t &refine) {
+  return context->hit_test(x, y, refine);
+}
+
 /**
  * @fn void draw_caret(const int, const int, const int)
  * @brief
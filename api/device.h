@@ -45,6 +45,9 @@
 namespace uxdevice {
 
 class event;
+class text_source_t;
+class text_span_t;
+class text_number_t;
 
 class bounds {
 public:
@@ -140,24 +143,56 @@ public:
    */
   template <typename T> surface_area_t &operator<<(const T &data) {
 
-    // display units and event listeners are intercepted here.
-    if constexpr (std::is_base_of<display_unit_t, T>::value ||
-                  std::is_base_of<listener_t<T>, T>::value) {
-      std::shared_ptr<T> obj = display_list<T>(data);
-      operator<<(obj);
+    // event listeners and display units are intercepted here.
+    if constexpr (std::is_base_of<listener_base_t, T>::value) {
+      listen(T::id, data.dispatch_event);
+
+    } else if constexpr (std::is_base_of<display_unit_t, T>::value) {
+      /// @brief the copy is owned by the system, changes are made through
+      /// the index which notifies.
+      insert_unit(std::allocate_shared<T>(
+                      unit_allocator_t<T>(display_list_arena), data),
+                  false);
+
+      // text types have a stream_input routine.
+    } else if constexpr (std::is_same<T, std::string>::value ||
+                         std::is_same<T, std::string_view>::value ||
+                         std::is_same<T, std::stringstream>::value ||
+                         std::is_same<T, text_source_t>::value ||
+                         std::is_same<T, text_span_t>::value ||
+                         std::is_same<T, text_number_t>::value) {
+      stream_input(data);
+
+      // the format applies to the numbers that follow.
+    } else if constexpr (std::is_same<T, text_number_format_t>::value) {
+      number_format = data;
+
+      // numbers are formatted without a stream.
+    } else if constexpr (text_number_type_t<T>::value) {
+      char buffer[text_number_format_t::buffer_size];
+      std::size_t len =
+          number_format.format(buffer, buffer + sizeof(buffer), data);
+      stream_input(std::string(buffer, len));
 
       // otherwise the input is another type. Try
       // the default string stream.
     } else {
       std::ostringstream s;
       s << data;
-      std::string sData = s.str();
-      stream_input(sData);
+      stream_input(s.str());
     }
 
     return *this;
   }
 
+  /**
+   * @fn operator<<
+   * @brief the string is moved into the text_data_t unit rather than copied.
+   */
+  surface_area_t &operator<<(std::string &&data) {
+    return stream_input(std::move(data));
+  }
+
   /**
    * @fn operator<<
    * @brief
@@ -166,30 +201,14 @@ public:
   surface_area_t &operator<<(const std::shared_ptr<T> obj) {
 
     // if the item is an event listener it is placed into a separate area.
-    if constexpr (std::is_base_of<listener_t<T>, T>::value) {
+    if constexpr (std::is_base_of<listener_base_t, T>::value) {
+      listen(T::id, obj->dispatch_event);
 
       // display units are handled distinctly
     } else if constexpr (std::is_base_of<display_unit_t, T>::value) {
-      /// @brief add to display list.
-      display_list<T>(obj);
-
-      /// @brief handle the typed index
-      if constexpr (std::is_base_of<typed_index_t<T>, T>::value)
-        maintain_index(std::dynamic_pointer_cast<display_unit_t>(obj));
-
-      // all objects that are tracked as visitors inherit from this base
-      // the display context holds the entire list for all types of visitors.
-      // These visitors are stored within the pipeline memory. the
-      // abstract interface function must be bound to an implementation. the
-      // init_dispatch function accomplishes this.
-      if constexpr (std::is_base_of<visitor_base_t, T>::value) {
-        obj->init_dispatch();
-        context->pipeline_memory_store<T>(obj);
-      }
-
-      // if the item is a drawing output object, inform the context of it.
-      if constexpr (std::is_base_of<display_visual_t, T>::value)
-        context->add_visual(obj);
+      /// @brief the caller holds the object and may change it without
+      /// calling changed(), so it is hashed for change detection.
+      insert_unit(obj, true);
 
     } else {
       stream_input(obj);
@@ -209,6 +228,62 @@ public:
   UX_DECLARE_STREAM_INTERFACE(std::string)
   UX_DECLARE_STREAM_INTERFACE(std::stringstream)
   UX_DECLARE_STREAM_INTERFACE(std::string_view)
+  UX_DECLARE_STREAM_INTERFACE(text_source_t)
+  UX_DECLARE_STREAM_INTERFACE(text_span_t)
+  UX_DECLARE_STREAM_INTERFACE(text_number_t)
+
+private:
+  surface_area_t &stream_input(std::string &&_val);
+
+  /**
+   * @fn adopt
+   * @tparam T
+   * @brief moves a display unit into system ownership. The text inputs use
+   * this so the text is not copied again when the unit is allocated.
+   */
+  template <typename T> void adopt(T &&data) {
+    insert_unit(std::allocate_shared<T>(
+                    unit_allocator_t<T>(display_list_arena), std::move(data)),
+                false);
+  }
+
+  /**
+   * @fn insert_unit
+   * @tparam T
+   * @param const std::shared_ptr<T> obj
+   * @param bool bvolatile - the unit can change without notification.
+   * @brief the insertion path shared by units given by value, owned by the
+   * system, and by shared pointer, held by the caller. Volatility is set
+   * first as the context decides from it whether a visual is hashed each
+   * render when the visual is added.
+   */
+  template <typename T>
+  void insert_unit(const std::shared_ptr<T> obj, bool bvolatile) {
+    obj->__hash_volatile = bvolatile;
+
+    /// @brief add to display list.
+    display_list<T>(obj);
+
+    /// @brief handle the typed index
+    if constexpr (std::is_base_of<typed_index_t<T>, T>::value)
+      maintain_index(std::dynamic_pointer_cast<display_unit_t>(obj));
+
+    // all objects that are tracked as visitors inherit from this base
+    // the display context holds the entire list for all types of visitors.
+    // These visitors are stored within the pipeline memory. the
+    // abstract interface function must be bound to an implementation. the
+    // init_dispatch function accomplishes this.
+    if constexpr (std::is_base_of<visitor_base_t, T>::value) {
+      obj->init_dispatch();
+      context->pipeline_memory_store<T>(obj);
+    }
+
+    // if the item is a drawing output object, inform the context of it.
+    if constexpr (std::is_base_of<display_visual_t, T>::value) {
+      context->add_visual(obj);
+      assert(obj->hash_volatile() || !context->visual_volatile(obj.get()));
+    }
+  }
 
   /** declares the interface and implementation for these objects when these
    * are invoked, the pipeline_memory class is also updated. When rendering
@@ -246,7 +321,7 @@ public:
     auto n = mapped_objects.find(o.key);
     if (n != mapped_objects.end()) {
       ptr = std::dynamic_pointer_cast<T>(n->second);
-      ptr->changed();
+      state_changed(n->second);
     }
     return *ptr;
   }
@@ -262,7 +337,7 @@ public:
   template <typename T> T &get(const std::string &key) {
     auto n = mapped_objects.find(indirect_index_storage_t{key});
     if (n != mapped_objects.end())
-      n->second->changed();
+      state_changed(n->second);
     return *std::dynamic_pointer_cast<T>(n->second);
   }
 
@@ -275,6 +350,25 @@ public:
   void clear(void);
   void notify_complete(void);
 
+  surface_area_t &batch_begin(void);
+  surface_area_t &batch_commit(void);
+
+  /**
+   * @fn in_batch
+   * @tparam ITER
+   * @brief streams each item of the range within one batch.
+   */
+  template <typename ITER> surface_area_t &in_batch(ITER first, ITER last) {
+    batch_begin();
+    for (; first != last; first++)
+      operator<<(*first);
+    return batch_commit();
+  }
+
+  template <typename RANGE> surface_area_t &in_batch(const RANGE &r) {
+    return in_batch(std::begin(r), std::end(r));
+  }
+
   surface_area_t &save(void);
   surface_area_t &restore(void);
 
@@ -301,43 +395,63 @@ public:
   void clip(bool bPreserve = false);
   bool in_clip(double x, double y);
 
+  /// @brief the top most visual drawn at the point, such as the pointer
+  /// position of a mouse event.
+  std::shared_ptr<display_visual_t> hit_test(double x, double y);
+  std::shared_ptr<display_visual_t> hit_test(double x, double y,
+                                             const hit_refine_t &refine);
+
 private:
   void start_processing(void);
   void draw_caret(const int x, const int y, const int h);
 
   void render_loop(void);
+  void reactor_loop(void);
   void dispatch_event(const event_t &e);
 
   void set_surface_defaults(void);
   void maintain_index(const std::shared_ptr<display_unit_t> obj);
+  void state_changed(const std::shared_ptr<display_unit_t> obj);
+  void changes_commit(void);
 
 private:
   std::shared_ptr<linked_window_manager_t> window_manager = {};
   std::shared_ptr<display_context_t> context = {};
   std::atomic<bool> bProcessing = false;
 
+  /// @brief in reactor threading, frames are given no closer than this.
+  std::chrono::nanoseconds frame_interval = std::chrono::nanoseconds(16666667);
+
+  /// @brief nesting count of batch_begin calls.
+  std::size_t batch_depth = {};
+
+  /// @brief set by inserting a text_number_format_t.
+  text_number_format_t number_format = {};
+
   event_handler_t fnEvents = nullptr;
 
   std::unordered_map<indirect_index_storage_t, std::shared_ptr<display_unit_t>>
       mapped_objects = {};
 
-  std::list<event_handler_t> onfocus = {};
-  std::list<event_handler_t> onblur = {};
-  std::list<event_handler_t> onresize = {};
-  std::list<event_handler_t> onkeydown = {};
-  std::list<event_handler_t> onkeyup = {};
-  std::list<event_handler_t> onkeypress = {};
-  std::list<event_handler_t> onmouseenter = {};
-  std::list<event_handler_t> onmouseleave = {};
-  std::list<event_handler_t> onmousemove = {};
-  std::list<event_handler_t> onmousedown = {};
-  std::list<event_handler_t> onmouseup = {};
-  std::list<event_handler_t> onclick = {};
-  std::list<event_handler_t> ondblclick = {};
-  std::list<event_handler_t> oncontextmenu = {};
-  std::list<event_handler_t> onwheel = {};
-
-  std::list<event_handler_t> &get_event_vector(std::type_index evt_type);
+  /// @brief indexed units returned for change by operator[] or get<T>(). The
+  /// caller changes them through the reference after the call, so they are
+  /// marked and notified at notify_complete() or batch_commit().
+  std::unordered_set<std::shared_ptr<display_unit_t>> changes_pending = {};
+
+  /// @brief handlers of each event kind, indexed by event_id_t. A list is
+  /// replaced rather than changed when a listener is added, so dispatch
+  /// reads it without a lock and a handler may add listeners. The slots are
+  /// accessed with the std::atomic_load and std::atomic_store shared_ptr
+  /// overloads, deprecated in C++20 for std::atomic<std::shared_ptr<T>>.
+  using event_handlers_t = std::vector<event_handler_t>;
+  std::mutex listeners_mutex = {};
+  std::array<std::shared_ptr<const event_handlers_t>,
+             static_cast<std::size_t>(event_id_t::count)>
+      listeners = {};
+
+  void listen(const event_id_t id, const event_handler_t &fn);
+  std::shared_ptr<const event_handlers_t>
+  get_event_vector(const event_id_t id);
 }; // namespace uxdevice
 
 } // namespace uxdevice
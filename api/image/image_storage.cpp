@@ -95,6 +95,23 @@ std::size_t uxdevice::image_block_storage_t::hash_code(void) const noexcept {
   return __value;
 }
 
+/**
+ * @internal
+ * @fn image_block_storage_t::hash_generation
+ * @brief the generation of the object combined with the linked attributes.
+ */
+std::size_t
+uxdevice::image_block_storage_t::hash_generation(void) const noexcept {
+  std::size_t __value = hash_members_t::hash_generation();
+  hash_combine(__value, pipeline_memory_hash_generation());
+  return __value;
+}
+
+/// @brief hashed each test when a linked attribute is volatile.
+bool uxdevice::image_block_storage_t::hash_volatile(void) const noexcept {
+  return hash_members_t::hash_volatile() || pipeline_memory_hash_volatile();
+}
+
 /**
  * @internal
  * @fn pipeline_acquire
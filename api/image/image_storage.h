@@ -70,6 +70,10 @@ public:
 
   std::size_t hash_code(void) const noexcept;
 
+  /// @brief linked attributes are part of the change detection.
+  std::size_t hash_generation(void) const noexcept;
+  bool hash_volatile(void) const noexcept;
+
   void pipeline_acquire();
   bool pipeline_has_required_linkages(void);
 
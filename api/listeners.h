@@ -27,42 +27,70 @@
 
 namespace uxdevice {
 
+/**
+ * @enum event_id_t
+ * @brief compact identity of each event kind. The listener types carry theirs
+ * as a constant and the device layer assigns one to each message it
+ * interprets, so handlers are found by index rather than a type lookup.
+ */
+enum class event_id_t : std::uint8_t {
+  none,
+  close_window,
+  paint,
+  focus,
+  blur,
+  resize,
+  keydown,
+  keyup,
+  keypress,
+  mouseenter,
+  mouseleave,
+  mousemove,
+  mousedown,
+  mouseup,
+  click,
+  dblclick,
+  contextmenu,
+  wheel,
+  count
+};
+
 /**
 \class event
 
 \brief the event class provides the communication between the event system and
 the caller. There is one event class for all of the distinct events. Simply
 different constructors are selected based upon the necessity of information
-given within the parameters.
+given within the parameters. The class is trivially copyable so events are
+passed without allocation.
 */
 using event_t = class event_t {
 public:
-  event_t(const std::type_index &et) : type(et) {}
-  event_t(const std::type_index &et, const char &k) : type(et), key(k) {}
-  event_t(const std::type_index &et, const unsigned int &vk)
+  event_t(const event_id_t et) : type(et) {}
+  event_t(const event_id_t et, const char &k) : type(et), key(k) {}
+  event_t(const event_id_t et, const unsigned int &vk)
     : type(et), virtualKey(vk), isVirtualKey(true) {}
 
-  event_t(const std::type_index &et, const short &mx, const short &my,
+  event_t(const event_id_t et, const short &mx, const short &my,
           const short &mb_dis)
     : type(et), x(mx), y(my) {
     distance = mb_dis;
     button = static_cast<char>(mb_dis);
   }
-  event_t(const std::type_index &et, const short &_w, const short &_h)
+  event_t(const event_id_t et, const short &_w, const short &_h)
     : type(et), x(_w), y(_h), w(_w), h(_h) {}
 
-  event_t(const std::type_index &et, const short &_x, const short &_y,
+  event_t(const event_id_t et, const short &_x, const short &_y,
           const short &_w, const short &_h)
     : type(et), x(_x), y(_y), w(_w), h(_h) {}
-  event_t(const std::type_index &et, const short &_distance)
+  event_t(const event_id_t et, const short &_distance)
     : type(et), distance(_distance) {}
-  ~event_t(){};
 
 public:
-  std::type_index type = std::type_index(typeid(this));
+  event_id_t type = event_id_t::none;
 
   unsigned int virtualKey = 0;
-  std::wstring unicodeKeys = L"";
+  char32_t unicode = 0;
   bool isVirtualKey = false;
   char key = 0x00;
 
@@ -75,6 +103,9 @@ public:
   short distance = 0;
 };
 
+static_assert(std::is_trivially_copyable<event_t>::value,
+              "event_t is passed by value to each handler.");
+
 /// \typedef event_handler_t is used to note and declare a lambda function for
 /// the specified event.
 typedef std::function<void(const event_t &et)> event_handler_t;
@@ -89,20 +120,26 @@ typedef std::function<void(const event_t &et)> event_handler_t;
 
 
 */
-template <typename T>
-class listener_t : public typed_index_t<T>, virtual public hash_members_t {
+class listener_base_t {};
+
+template <typename T, event_id_t ID>
+class listener_t : public listener_base_t,
+                   public typed_index_t<T>,
+                   virtual public hash_members_t {
 public:
   listener_t() = delete;
-  listener_t(event_handler_t _dispatch)
-    : ti(std::type_index(typeid(T))), dispatch_event(_dispatch) {}
+  listener_t(event_handler_t _dispatch) : dispatch_event(_dispatch) {}
 
   std::size_t hash_code(void) const noexcept {
     std::size_t __value = {};
-    hash_combine(__value, typed_index_t<T>::hash_code(), ti);
+    hash_combine(__value, typed_index_t<T>::hash_code(),
+                 static_cast<std::size_t>(ID));
     return __value;
   }
 
-  std::type_index ti;
+  /// @brief the index of the handler list the listener is placed in.
+  static constexpr event_id_t id = ID;
+
   event_handler_t dispatch_event;
 };
 
@@ -110,7 +147,8 @@ public:
  @class
  @brief
  */
-class listen_close_window_t : public listener_t<listen_close_window_t> {
+class listen_close_window_t
+    : public listener_t<listen_close_window_t, event_id_t::close_window> {
   using listener_t::listener_t;
 };
 
@@ -118,7 +156,7 @@ class listen_close_window_t : public listener_t<listen_close_window_t> {
  @class
  @brief
  */
-class listen_paint_t : public listener_t<listen_paint_t> {
+class listen_paint_t : public listener_t<listen_paint_t, event_id_t::paint> {
   using listener_t::listener_t;
 };
 
@@ -126,7 +164,7 @@ class listen_paint_t : public listener_t<listen_paint_t> {
  @class
  @brief
  */
-class listen_focus_t : public listener_t<listen_focus_t> {
+class listen_focus_t : public listener_t<listen_focus_t, event_id_t::focus> {
   using listener_t::listener_t;
 };
 
@@ -134,7 +172,7 @@ class listen_focus_t : public listener_t<listen_focus_t> {
  @class
  @brief
  */
-class listen_blur_t : public listener_t<listen_blur_t> {
+class listen_blur_t : public listener_t<listen_blur_t, event_id_t::blur> {
   using listener_t::listener_t;
 };
 
@@ -142,7 +180,7 @@ class listen_blur_t : public listener_t<listen_blur_t> {
  @class
  @brief
  */
-class listen_resize_t : public listener_t<listen_resize_t> {
+class listen_resize_t : public listener_t<listen_resize_t, event_id_t::resize> {
 public:
   using listener_t::listener_t;
 };
@@ -152,7 +190,8 @@ public:
  @class
  @brief
  */
-class listen_keydown_t : public listener_t<listen_keydown_t> {
+class listen_keydown_t
+    : public listener_t<listen_keydown_t, event_id_t::keydown> {
 public:
   using listener_t::listener_t;
 };
@@ -161,7 +200,7 @@ public:
  @class
  @brief
  */
-class listen_keyup_t : public listener_t<listen_keyup_t> {
+class listen_keyup_t : public listener_t<listen_keyup_t, event_id_t::keyup> {
 public:
   using listener_t::listener_t;
 };
@@ -170,7 +209,8 @@ public:
  @class
  @brief
  */
-class listen_keypress_t : public listener_t<listen_keypress_t> {
+class listen_keypress_t
+    : public listener_t<listen_keypress_t, event_id_t::keypress> {
 public:
   using listener_t::listener_t;
 };
@@ -179,7 +219,8 @@ public:
  @class
  @brief
  */
-class listen_mouseenter_t : public listener_t<listen_mouseenter_t> {
+class listen_mouseenter_t
+    : public listener_t<listen_mouseenter_t, event_id_t::mouseenter> {
 public:
   using listener_t::listener_t;
 };
@@ -188,7 +229,8 @@ public:
  @class
  @brief
  */
-class listen_mousemove_t : public listener_t<listen_mousemove_t> {
+class listen_mousemove_t
+    : public listener_t<listen_mousemove_t, event_id_t::mousemove> {
 public:
   using listener_t::listener_t;
 };
@@ -197,7 +239,8 @@ public:
  @class
  @brief
  */
-class listen_mousedown_t : public listener_t<listen_mousedown_t> {
+class listen_mousedown_t
+    : public listener_t<listen_mousedown_t, event_id_t::mousedown> {
 public:
   using listener_t::listener_t;
 };
@@ -206,7 +249,8 @@ public:
  @class
  @brief
  */
-class listen_mouseup_t : public listener_t<listen_mouseup_t> {
+class listen_mouseup_t
+    : public listener_t<listen_mouseup_t, event_id_t::mouseup> {
 public:
   using listener_t::listener_t;
 };
@@ -215,7 +259,7 @@ public:
  @class
  @brief
  */
-class listen_click_t : public listener_t<listen_click_t> {
+class listen_click_t : public listener_t<listen_click_t, event_id_t::click> {
 public:
   using listener_t::listener_t;
 };
@@ -224,7 +268,8 @@ public:
  @class
  @brief
  */
-class listen_dblclick_t : public listener_t<listen_dblclick_t> {
+class listen_dblclick_t
+    : public listener_t<listen_dblclick_t, event_id_t::dblclick> {
 public:
   using listener_t::listener_t;
 };
@@ -233,7 +278,8 @@ public:
  @class
  @brief
  */
-class listen_contextmenu_t : public listener_t<listen_contextmenu_t> {
+class listen_contextmenu_t
+    : public listener_t<listen_contextmenu_t, event_id_t::contextmenu> {
 public:
   using listener_t::listener_t;
 };
@@ -242,7 +288,7 @@ public:
  @class
  @brief
  */
-class listen_wheel_t : public listener_t<listen_wheel_t> {
+class listen_wheel_t : public listener_t<listen_wheel_t, event_id_t::wheel> {
 public:
   using listener_t::listener_t;
 };
@@ -251,7 +297,8 @@ public:
  @class
  @brief
  */
-class listen_mouseleave_t : public listener_t<listen_mouseleave_t> {
+class listen_mouseleave_t
+    : public listener_t<listen_mouseleave_t, event_id_t::mouseleave> {
 public:
   using listener_t::listener_t;
 };
@@ -0,0 +1,56 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @author Anthony Matarazzo
+ * @file atlas.cpp
+ * @date 10/18/26
+ * @version 1.0
+ * @brief emit implementations for objects.
+ */
+// clang-format off
+
+#include <api/text/atlas.h>
+#include <base/unit_object.h>
+
+// clang-format on
+
+/**
+ * @internal
+ * @fn text_render_atlas_t::emit
+ * @param display_context_t &context
+ * @brief glyphs are rasterized once into the shared atlas and composited as
+ * masks. Suited to screens having many small labels. The emit function removes
+ * the other text render modes from the display memory as they are exclusive.
+ */
+void uxdevice::text_render_atlas_t::emit(display_context_t *context) {
+  context->pipeline_memory_reset<text_render_normal_t>();
+  context->pipeline_memory_reset<text_render_path_t>();
+}
+
+/**
+ * @internal
+ * @fn text_render_atlas_t::emit
+ * @param cairo_t *cr
+ * @param PangoLayout *layout
+ * @brief draws the shaped layout from the glyph atlas.
+ */
+void uxdevice::text_render_atlas_t::emit(cairo_t *cr, PangoLayout *layout) {
+  glyph_atlas_t::instance().show_layout(cr,
+                                        text_shaping_cache_t::shaped(layout));
+}
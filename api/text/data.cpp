@@ -48,7 +48,8 @@ void uxdevice::text_data_t::emit(PangoLayout *layout) {
 
                           [&](std::string_view &s) {
                             if (s.compare(sinternal) != 0)
-                              pango_layout_set_text(layout, s.data(), -1);
+                              pango_layout_set_text(layout, s.data(),
+                                                    static_cast<int>(s.size()));
                           },
 
                           [&](std::shared_ptr<std::string> ps) {
@@ -58,18 +59,131 @@ void uxdevice::text_data_t::emit(PangoLayout *layout) {
 
                           [&](std::shared_ptr<std::string_view> ps) {
                             if (ps->compare(sinternal) != 0)
-                              pango_layout_set_text(layout, ps->data(), -1);
+                              pango_layout_set_text(
+                                  layout, ps->data(),
+                                  static_cast<int>(ps->size()));
                           },
 
                           [&](std::shared_ptr<std::stringstream> ps) {
                             std::string stmp = ps->str();
                             if (stmp.compare(sinternal) != 0)
                               pango_layout_set_text(layout, stmp.data(), -1);
+                          },
+
+                          [&](std::shared_ptr<text_source_t> ps) {
+                            emit_source(layout, ps.get());
+                          },
+
+                          [&](std::shared_ptr<text_number_t> ps) {
+                            emit_number(layout, ps.get());
+                          },
+
+                          [&](text_span_t &s) {
+                            if (s.view.compare(sinternal) != 0)
+                              pango_layout_set_text(
+                                  layout, s.view.data(),
+                                  static_cast<int>(s.view.size()));
                           }};
 
   std::visit(text_data_visitor, value);
 }
 
+/**
+ * @internal
+ * @fn text_data_t::emit_source
+ * @param PangoLayout *layout
+ * @param text_source_t *ps
+ * @brief the identity and version of the source last given to the layout
+ * are noted on the layout. The identity is used rather than the address, as a
+ * new source may be allocated where a released one was. When neither
+ * differs, the text is not read. Pango shapes the text of
+ * a layout as a whole, so a change sets the entire text. Consumers that lay
+ * out the text in blocks do not emit it, they use text_source_t::read_changes
+ * to limit the work.
+ */
+void uxdevice::text_data_t::emit_source(PangoLayout *layout,
+                                        text_source_t *ps) {
+  static GQuark source_quark = g_quark_from_static_string("uxdevice-source");
+  static GQuark version_quark =
+      g_quark_from_static_string("uxdevice-source-version");
+
+  if (GPOINTER_TO_SIZE(g_object_get_qdata(G_OBJECT(layout), source_quark)) ==
+          ps->id() &&
+      GPOINTER_TO_SIZE(g_object_get_qdata(G_OBJECT(layout), version_quark)) ==
+          ps->version())
+    return;
+
+  ps->read([&](const std::string &s, std::size_t version) {
+    pango_layout_set_text(layout, s.data(), static_cast<int>(s.size()));
+    g_object_set_qdata(G_OBJECT(layout), source_quark,
+                       GSIZE_TO_POINTER(ps->id()));
+    g_object_set_qdata(G_OBJECT(layout), version_quark,
+                       GSIZE_TO_POINTER(version));
+  });
+}
+
+/**
+ * @internal
+ * @fn text_data_t::emit_number
+ * @param PangoLayout *layout
+ * @param text_number_t *ps
+ * @brief sets the text when the identity or version differs from the one
+ * last given to the layout. When the new text only changes digits in place
+ * and the number uses equal width digits, the metrics_stable_t of the layout
+ * is armed with the version and the serials around the change so the textual
+ * render keeps the prior extents.
+ */
+void uxdevice::text_data_t::emit_number(PangoLayout *layout,
+                                        text_number_t *ps) {
+  static GQuark number_quark = g_quark_from_static_string("uxdevice-number");
+  static GQuark version_quark =
+      g_quark_from_static_string("uxdevice-number-version");
+
+  bool bsame_source =
+      GPOINTER_TO_SIZE(g_object_get_qdata(G_OBJECT(layout), number_quark)) ==
+      ps->id();
+  if (bsame_source &&
+      GPOINTER_TO_SIZE(g_object_get_qdata(G_OBJECT(layout), version_quark)) ==
+          ps->version())
+    return;
+
+  ps->read([&](const std::string &s, std::size_t version) {
+    std::string_view prior = pango_layout_get_text(layout);
+    bool bstable = bsame_source && ps->monospace_digits &&
+                   prior.size() == s.size() &&
+                   std::equal(prior.begin(), prior.end(), s.begin(),
+                              [](char a, char b) {
+                                return a == b ||
+                                       (std::isdigit(
+                                            static_cast<unsigned char>(a)) &&
+                                        std::isdigit(
+                                            static_cast<unsigned char>(b)));
+                              });
+
+    GQuark stable_quark = text_number_t::metrics_stable_quark();
+    auto stable = static_cast<text_number_t::metrics_stable_t *>(
+        g_object_get_qdata(G_OBJECT(layout), stable_quark));
+    if (!stable) {
+      stable = new text_number_t::metrics_stable_t{};
+      g_object_set_qdata_full(G_OBJECT(layout), stable_quark, stable,
+                              [](gpointer p) {
+                                delete static_cast<
+                                    text_number_t::metrics_stable_t *>(p);
+                              });
+    }
+
+    stable->serial_before = pango_layout_get_serial(layout);
+    pango_layout_set_text(layout, s.data(), static_cast<int>(s.size()));
+    stable->serial_after = pango_layout_get_serial(layout);
+    stable->version = bstable ? version : 0;
+
+    g_object_set_qdata(G_OBJECT(layout), number_quark,
+                       GSIZE_TO_POINTER(ps->id()));
+    g_object_set_qdata(G_OBJECT(layout), version_quark,
+                       GSIZE_TO_POINTER(version));
+  });
+}
+
 /**
  * @internal
  * @fn text_data_t::hash_code
@@ -80,16 +194,42 @@ std::size_t uxdevice::text_data_t::hash_code(void) const noexcept {
   std::size_t __value = std::type_index(typeid(text_data_t)).hash_code();
 
   auto text_data_visitor = overload_visitors_t{
-      [&](std::string s) { hash_combine(__value, s); },
-      [&](std::string_view s) { hash_combine(__value, s); },
-      [&](std::shared_ptr<std::string> ps) { hash_combine(__value, *ps); },
-      [&](std::shared_ptr<std::string_view> ps) { hash_combine(__value, *ps); },
-      [&](std::shared_ptr<std::stringstream> ps) {
-        std::string stmp = ps->str();
-        hash_combine(__value, stmp);
+      [&](const std::string &s) { hash_combine(__value, s); },
+      [&](const std::string_view &s) { hash_combine(__value, s); },
+      [&](const std::shared_ptr<std::string> &ps) {
+        hash_combine(__value, *ps);
+      },
+      [&](const std::shared_ptr<std::string_view> &ps) {
+        hash_combine(__value, *ps);
+      },
+      [&](const std::shared_ptr<std::stringstream> &ps) {
+        hash_combine(__value, ps->str());
+      },
+      [&](const std::shared_ptr<text_source_t> &ps) {
+        hash_combine(__value, ps->id(), ps->version());
+      },
+      [&](const text_span_t &s) { hash_combine(__value, s.view); },
+      [&](const std::shared_ptr<text_number_t> &ps) {
+        hash_combine(__value, ps->id(), ps->version());
       }};
 
   std::visit(text_data_visitor, value);
 
   return __value;
 }
+
+/**
+ * @internal
+ * @fn text_data_t::hash_volatile
+ * @brief text held through a pointer or view is changed by the caller without
+ * notification, so it is hashed for each change test. A text_source_t hashes
+ * its version. A text_span_t is fixed while inserted. A text_number_t
+ * announces its changes.
+ * @return bool
+ */
+bool uxdevice::text_data_t::hash_volatile(void) const noexcept {
+  return !(std::holds_alternative<std::string>(value) ||
+           std::holds_alternative<text_span_t>(value) ||
+           std::holds_alternative<std::shared_ptr<text_number_t>>(value)) ||
+         hash_members_t::hash_volatile();
+}
@@ -26,13 +26,19 @@
 
 #pragma once
 
+namespace uxdevice {
+
 /**
  * @typedef text_data_storage_t
- * @brief
+ * @brief the shared_ptr<text_source_t> alternative is compared by version
+ * rather than by content, as is shared_ptr<text_number_t>. text_span_t refers
+ * to the caller's bytes.
  */
 typedef std::variant<std::string, std::shared_ptr<std::string>,
                      std::string_view, std::shared_ptr<std::string_view>,
-                     std::shared_ptr<std::stringstream>>
+                     std::shared_ptr<std::stringstream>,
+                     std::shared_ptr<text_source_t>, text_span_t,
+                     std::shared_ptr<text_number_t>>
     text_data_storage_t;
 
 /**
@@ -48,7 +54,46 @@ class text_data_t
 public:
   using storage_emitter_t::storage_emitter_t;
   std::size_t hash_code(void) const noexcept;
+  bool hash_volatile(void) const noexcept;
   void emit(PangoLayout *layout);
+
+  /**
+   * @fn read
+   * @tparam FN
+   * @param FN fn - called with a const std::string_view & of the text.
+   * @brief gives the text without setting it on a layout. The text of a
+   * text_source_t or text_number_t is given while it is locked.
+   */
+  template <typename FN> void read(FN fn) const {
+    auto text_data_visitor = overload_visitors_t{
+        [&](const std::string &s) { fn(std::string_view(s)); },
+        [&](const std::string_view &s) { fn(s); },
+        [&](const std::shared_ptr<std::string> &ps) {
+          fn(std::string_view(*ps));
+        },
+        [&](const std::shared_ptr<std::string_view> &ps) { fn(*ps); },
+        [&](const std::shared_ptr<std::stringstream> &ps) {
+          std::string stmp = ps->str();
+          fn(std::string_view(stmp));
+        },
+        [&](const std::shared_ptr<text_source_t> &ps) {
+          ps->read([&](const std::string &s, std::size_t) {
+            fn(std::string_view(s));
+          });
+        },
+        [&](const text_span_t &s) { fn(s.view); },
+        [&](const std::shared_ptr<text_number_t> &ps) {
+          ps->read([&](const std::string &s, std::size_t) {
+            fn(std::string_view(s));
+          });
+        }};
+
+    std::visit(text_data_visitor, value);
+  }
+
+private:
+  void emit_source(PangoLayout *layout, text_source_t *ps);
+  void emit_number(PangoLayout *layout, text_number_t *ps);
 };
-}
+} // namespace uxdevice
 UX_REGISTER_STD_HASH_SPECIALIZATION(uxdevice::text_data_t)
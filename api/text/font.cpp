@@ -38,18 +38,24 @@
  */
 void uxdevice::text_font_t::emit(PangoLayout *layout) {
   if (!font_ptr) {
-    font_ptr = pango_font_description_from_string(description.data());
+    font_ptr = font_description_intern_t::instance().intern(description);
     if (!font_ptr) {
       std::string s = "Font could not be loaded from description. ( ";
       s += description + ")";
       error_report(s);
+      return;
     }
   }
 
-  const PangoFontDescription *internal_description =
-      pango_layout_get_font_description(layout);
-  if (!internal_description ||
-      !pango_font_description_equal(internal_description, font_ptr))
-    if (font_ptr)
-      pango_layout_set_font_description(layout, font_ptr);
+  /** @brief the layout keeps a copy of the description it is given. The
+   * interned pointer last applied is noted on the layout so that the
+   * comparison is a pointer compare rather than a field by field one.*/
+  static GQuark applied_font_quark =
+      g_quark_from_static_string("uxdevice-applied-font");
+
+  if (g_object_get_qdata(G_OBJECT(layout), applied_font_quark) != font_ptr) {
+    pango_layout_set_font_description(layout, font_ptr);
+    g_object_set_qdata(G_OBJECT(layout), applied_font_quark,
+                       const_cast<PangoFontDescription *>(font_ptr));
+  }
 }
@@ -40,33 +40,34 @@ uxdevice::text_font_storage_t::text_font_storage_t(
 /// @brief move constructor
 uxdevice::text_font_storage_t::text_font_storage_t(
     text_font_storage_t &&other) noexcept
-    : description(other.description), font_ptr(other.font_ptr) {}
+    : description(std::move(other.description)), font_ptr(other.font_ptr) {}
 
-/// @brief copy constructor
+/// @brief copy constructor. The interned font is shared.
 uxdevice::text_font_storage_t::text_font_storage_t(
     const text_font_storage_t &other)
-    : description(other.description), font_ptr(nullptr) {}
+    : description(other.description), font_ptr(other.font_ptr) {}
 
-uxdevice::text_font_storage_t::~text_font_storage_t() {
-  if (font_ptr)
-    pango_font_description_free(font_ptr);
-}
+/// @brief the font description belongs to the intern table.
+uxdevice::text_font_storage_t::~text_font_storage_t() {}
 
 uxdevice::text_font_storage_t &uxdevice::text_font_storage_t::operator=(
     const text_font_storage_t &&other) noexcept {
   description = other.description;
+  font_ptr = other.font_ptr;
   return *this;
 }
 
 uxdevice::text_font_storage_t &
 uxdevice::text_font_storage_t::operator=(const text_font_storage_t &other) {
   description = other.description;
+  font_ptr = other.font_ptr;
   return *this;
 }
 
 uxdevice::text_font_storage_t &
 uxdevice::text_font_storage_t::operator=(const std::string &_desc) {
   description = _desc;
+  font_ptr = nullptr;
   return *this;
 }
 
@@ -74,6 +75,7 @@ uxdevice::text_font_storage_t::operator=(const std::string &_desc) {
 uxdevice::text_font_storage_t &
 uxdevice::text_font_storage_t::operator=(const std::string &&_desc) noexcept {
   description = _desc;
+  font_ptr = nullptr;
   return *this;
 }
 
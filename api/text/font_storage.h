@@ -60,7 +60,9 @@ public:
   std::size_t hash_code(void) const noexcept;
 
   std::string description = {};
-  PangoFontDescription *font_ptr = {};
+
+  /// @brief shared from the font_description_intern_t table, not owned.
+  const PangoFontDescription *font_ptr = {};
 };
 } // namespace uxdevice
 UX_REGISTER_STD_HASH_SPECIALIZATION(uxdevice::text_font_storage_t)
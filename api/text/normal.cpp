@@ -41,6 +41,7 @@
  */
 void uxdevice::text_render_normal_t::emit(display_context_t *context) {
   context->pipeline_memory_reset<text_render_path_t>();
+  context->pipeline_memory_reset<text_render_atlas_t>();
 }
 
 /**
@@ -53,5 +54,5 @@ void uxdevice::text_render_normal_t::emit(display_context_t *context) {
 
  */
 void uxdevice::text_render_normal_t::emit(cairo_t *cr, PangoLayout *layout) {
-  pango_cairo_show_layout(cr, layout);
+  pango_cairo_show_layout(cr, text_shaping_cache_t::shaped(layout));
 }
@@ -0,0 +1,141 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @author Anthony Matarazzo
+ * @file number.cpp
+ * @date 10/18/26
+ * @version 1.0
+ * @brief numeric value shown as text that may be set from any thread.
+ */
+// clang-format off
+
+#include <api/text/number.h>
+#include <base/unit_object.h>
+
+// clang-format on
+
+/// @brief copy constructor
+uxdevice::text_number_t::text_number_t(const text_number_t &other)
+    : monospace_digits(other.monospace_digits.load()) {
+  std::lock_guard lock(other.number_mutex);
+  number_format = other.number_format;
+  text = other.text;
+  current_value = other.current_value;
+  current_version = other.current_version.load();
+}
+
+/// @brief copy assignment. The change function is not copied as it belongs
+/// to the insertion of the other number.
+uxdevice::text_number_t &
+uxdevice::text_number_t::operator=(const text_number_t &other) {
+  if (this == &other)
+    return *this;
+
+  std::scoped_lock lock(number_mutex, other.number_mutex);
+  monospace_digits = other.monospace_digits.load();
+  number_format = other.number_format;
+  text = other.text;
+  current_value = other.current_value;
+  current_version++;
+  return *this;
+}
+
+/**
+ * @internal
+ * @fn format
+ * @param const text_number_format_t &f
+ * @brief changes the format and formats the current value again.
+ */
+void uxdevice::text_number_t::format(const text_number_format_t &f) {
+  std::variant<std::intmax_t, std::uintmax_t, double> v = {};
+  {
+    std::lock_guard lock(number_mutex);
+    number_format = f;
+    v = current_value;
+  }
+  std::visit([&](auto n) { set(n); }, v);
+}
+
+/**
+ * @internal
+ * @fn changed
+ * @param const std::function<void(void)> &fn
+ * @brief installs the function called after set() changes the text. May be
+ * called while other threads set the number.
+ */
+void uxdevice::text_number_t::changed(const std::function<void(void)> &fn) {
+  auto p = std::make_shared<const std::function<void(void)>>(fn);
+  std::lock_guard lock(number_mutex);
+  fn_changed = std::move(p);
+}
+
+/**
+ * @internal
+ * @fn value
+ * @brief the current value. An integer beyond the precision of a double is
+ * rounded, the text holds it exactly.
+ * @return double
+ */
+double uxdevice::text_number_t::value(void) const {
+  std::lock_guard lock(number_mutex);
+  return std::visit([](auto n) { return static_cast<double>(n); },
+                    current_value);
+}
+
+/**
+ * @internal
+ * @fn next_id
+ * @brief issues the identity of a new number. Zero is not issued.
+ * @return std::size_t
+ */
+std::size_t uxdevice::text_number_t::next_id(void) {
+  static std::atomic<std::size_t> counter = 1;
+  return counter++;
+}
+
+/**
+ * @internal
+ * @fn update
+ * @param const char *s
+ * @param std::size_t len
+ * @brief stores the formatted text when it differs. called with the lock
+ * held.
+ * @return bool - true if the text changed.
+ */
+bool uxdevice::text_number_t::update(const char *s, std::size_t len) {
+  if (text.size() == len && text.compare(0, len, s, len) == 0)
+    return false;
+
+  text.assign(s, len);
+  current_version++;
+  return true;
+}
+
+/**
+ * @internal
+ * @fn metrics_stable_quark
+ * @brief names the metrics_stable_t layout data set by text_data_t when the
+ * new text has the same shape as the prior text. The textual render reuses
+ * its extents when it is armed and the number is the only change to the
+ * layout.
+ */
+GQuark uxdevice::text_number_t::metrics_stable_quark(void) {
+  static GQuark quark = g_quark_from_static_string("uxdevice-metrics-stable");
+  return quark;
+}
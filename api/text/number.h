@@ -0,0 +1,155 @@
+#pragma once
+
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ @author Anthony Matarazzo
+ @file number.h
+ @date 10/18/26
+ @version 1.0
+ @brief numeric value shown as text that may be set from any thread.
+ */
+
+namespace uxdevice {
+
+/**
+ * @class text_number_t
+ * @brief a number displayed by a textual render, such as a gauge reading or
+ * a table cell. set() formats the value and only when the text differs is
+ * the change announced, so a reading that rounds to the same text costs no
+ * render. When only digits change position for position and the font uses
+ * equal width digits, the layout metrics are reused rather than measured.
+ * Fonts with proportional digits should clear monospace_digits. Integers are
+ * kept as integers so that large values are written exactly.
+ *
+ * e.g.
+ *   auto cpu = std::make_shared<text_number_t>(0.0, text_number_format_t{1});
+ *   vis << coordinate_t{10, 10, 100, 20} << cpu;
+ *   cpu->set(42.5); // from any thread
+ */
+class text_number_t {
+public:
+  text_number_t() { set(0); }
+  text_number_t(double v, const text_number_format_t &f = {})
+      : number_format(f) {
+    set(v);
+  }
+  template <typename T,
+            typename = std::enable_if_t<text_number_type_t<T>::value &&
+                                        std::is_integral<T>::value>>
+  text_number_t(T v, const text_number_format_t &f = {}) : number_format(f) {
+    set(v);
+  }
+
+  /// @brief copy constructor
+  text_number_t(const text_number_t &other);
+
+  text_number_t &operator=(const text_number_t &other);
+
+  /**
+   * @fn set
+   * @tparam T - integral or floating point type.
+   * @param T v
+   * @brief may be called from any thread.
+   */
+  template <typename T> void set(T v) {
+    static_assert(text_number_type_t<T>::value,
+                  "text_number_t::set requires a numeric type.");
+    char buffer[text_number_format_t::buffer_size];
+    std::shared_ptr<const std::function<void(void)>> fn = {};
+
+    {
+      std::lock_guard lock(number_mutex);
+      if constexpr (std::is_floating_point<T>::value)
+        current_value = static_cast<double>(v);
+      else if constexpr (std::is_signed<T>::value)
+        current_value = static_cast<std::intmax_t>(v);
+      else
+        current_value = static_cast<std::uintmax_t>(v);
+
+      std::size_t len =
+          number_format.format(buffer, buffer + sizeof(buffer), v);
+      if (update(buffer, len))
+        fn = fn_changed;
+    }
+
+    if (fn)
+      (*fn)();
+  }
+
+  void changed(const std::function<void(void)> &fn);
+
+  void format(const text_number_format_t &f);
+
+  double value(void) const;
+  std::size_t version(void) const noexcept { return current_version; }
+  std::size_t id(void) const noexcept { return number_id; }
+
+  /**
+   * @fn read
+   * @tparam FN
+   * @param FN fn - called with a const std::string & and the version.
+   * @brief provides access to the text while it is locked.
+   */
+  template <typename FN> void read(FN fn) const {
+    std::lock_guard lock(number_mutex);
+    fn(text, current_version.load());
+  }
+
+  /**
+   * @class metrics_stable_t
+   * @brief layout data named by metrics_stable_quark. text_data_t arms it
+   * with the version it applied when the new text has the shape of the prior
+   * text, noting the layout serial before and after setting the text. The
+   * textual render reuses its extents only when the serials bracket the whole
+   * change of the pass, and disarms it.
+   */
+  class metrics_stable_t {
+  public:
+    std::size_t version = {};
+    guint serial_before = {};
+    guint serial_after = {};
+  };
+  static GQuark metrics_stable_quark(void);
+
+  /// @brief read by the render thread while the caller may change it.
+  std::atomic<bool> monospace_digits = true;
+
+private:
+  bool update(const char *s, std::size_t len);
+  static std::size_t next_id(void);
+
+  mutable std::mutex number_mutex = {};
+  text_number_format_t number_format = {};
+  std::string text = {};
+
+  /// @brief announces a change of text. Installed by changed() when the
+  /// number is inserted into a surface, which may happen while another thread
+  /// calls set(). Both read and write it under the number_mutex, set() calls
+  /// its copy after releasing the lock.
+  std::shared_ptr<const std::function<void(void)>> fn_changed = {};
+  std::variant<std::intmax_t, std::uintmax_t, double> current_value = {};
+  std::atomic<std::size_t> current_version = 1;
+
+  /// @brief unique within the process and never reused. A copy receives its
+  /// own.
+  std::size_t number_id = next_id();
+};
+
+} // namespace uxdevice
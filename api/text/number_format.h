@@ -0,0 +1,151 @@
+#pragma once
+
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ @author Anthony Matarazzo
+ @file number_format.h
+ @date 10/18/26
+ @version 1.0
+ @brief numeric formatting for the stream insertion of arithmetic types.
+ */
+
+namespace uxdevice {
+
+/**
+ * @class text_character_type_t
+ * @tparam T
+ * @brief true for the character types. These are integral yet are inserted
+ * as text through the stream rather than formatted as numbers.
+ */
+template <typename T> struct text_character_type_t : std::false_type {};
+template <> struct text_character_type_t<char> : std::true_type {};
+template <> struct text_character_type_t<signed char> : std::true_type {};
+template <> struct text_character_type_t<unsigned char> : std::true_type {};
+template <> struct text_character_type_t<wchar_t> : std::true_type {};
+#if defined(__cpp_char8_t)
+template <> struct text_character_type_t<char8_t> : std::true_type {};
+#endif
+template <> struct text_character_type_t<char16_t> : std::true_type {};
+template <> struct text_character_type_t<char32_t> : std::true_type {};
+
+/**
+ * @class text_number_type_t
+ * @tparam T
+ * @brief true for the types written by text_number_format_t::format, the
+ * floating point types and the integral types other than bool and the
+ * character types.
+ */
+template <typename T>
+struct text_number_type_t
+    : std::integral_constant<
+          bool, std::is_floating_point<std::remove_cv_t<T>>::value ||
+                    (std::is_integral<std::remove_cv_t<T>>::value &&
+                     !std::is_same<std::remove_cv_t<T>, bool>::value &&
+                     !text_character_type_t<std::remove_cv_t<T>>::value)> {};
+
+/**
+ * @class text_number_format_t
+ * @brief inserting this sets how the numbers that follow are formatted. The
+ * default matches the std::ostream defaults, six significant digits in the
+ * general style, so output is the same as before. Numbers are written with
+ * std::to_chars into a buffer on the stack, no stream or locale is involved.
+ *
+ * e.g. vis << text_number_format_t{2, 8} << 3.14159;  gives "    3.14"
+ */
+class text_number_format_t {
+public:
+  text_number_format_t() {}
+
+  /// @brief fixed notation with the given digits after the decimal point.
+  text_number_format_t(int _precision, std::size_t _width = 0,
+                       char _fill = ' ')
+      : style(std::chars_format::fixed), precision(_precision), width(_width),
+        fill(_fill) {}
+
+  text_number_format_t(std::chars_format _style, int _precision,
+                       std::size_t _width = 0, char _fill = ' ')
+      : style(_style), precision(_precision), width(_width), fill(_fill) {}
+
+  static const std::size_t buffer_size = 64;
+
+  /**
+   * @fn format
+   * @tparam T - integral or floating point type.
+   * @param char *first
+   * @param char *last
+   * @param T v
+   * @brief writes the number, padded on the left to the width. A fixed value
+   * too long for the buffer is written in scientific style. When the
+   * precision is also too long for that, the shortest form that reads back
+   * exactly is written, and failing that the printf %g form. A zero fill is
+   * placed after the sign, as printf does. A value that is not finite is
+   * padded with spaces.
+   * @return std::size_t - characters written, zero only when the buffer
+   * cannot hold the %g form.
+   */
+  template <typename T>
+  std::size_t format(char *first, char *last, T v) const {
+    std::to_chars_result r = {};
+    char pad = fill;
+
+    if constexpr (std::is_floating_point<T>::value) {
+      r = std::to_chars(first, last, v, style, precision);
+      if (r.ec != std::errc())
+        r = std::to_chars(first, last, v, std::chars_format::scientific,
+                          precision);
+      if (r.ec != std::errc())
+        r = std::to_chars(first, last, v);
+      if (r.ec != std::errc()) {
+        int n = std::snprintf(first, static_cast<std::size_t>(last - first),
+                              "%g", static_cast<double>(v));
+        if (n > 0 && n < last - first)
+          r = {first + n, std::errc()};
+      }
+
+      if (pad == '0' && !std::isfinite(v))
+        pad = ' ';
+    } else {
+      r = std::to_chars(first, last, v);
+    }
+
+    if (r.ec != std::errc())
+      return 0;
+
+    std::size_t len = static_cast<std::size_t>(r.ptr - first);
+    std::size_t capacity = static_cast<std::size_t>(last - first);
+
+    if (width > len && width <= capacity) {
+      /** @brief zeros follow the sign, "-003.14" rather than "00-3.14".*/
+      std::size_t sign = pad == '0' && (*first == '-' || *first == '+');
+      std::memmove(first + (width - len) + sign, first + sign, len - sign);
+      std::memset(first + sign, pad, width - len);
+      len = width;
+    }
+
+    return len;
+  }
+
+  std::chars_format style = std::chars_format::general;
+  int precision = 6;
+  std::size_t width = {};
+  char fill = ' ';
+};
+
+} // namespace uxdevice
@@ -40,6 +40,7 @@
  */
 void uxdevice::text_render_path_t::emit(display_context_t *context) {
   context->pipeline_memory_reset<text_render_normal_t>();
+  context->pipeline_memory_reset<text_render_atlas_t>();
 }
 
 /**
@@ -50,5 +51,5 @@ void uxdevice::text_render_path_t::emit(display_context_t *context) {
  * @brief invokes the pango api to render font text as a path from the layout
  */
 void uxdevice::text_render_path_t::emit(cairo_t *cr, PangoLayout *layout) {
-  pango_cairo_layout_path(cr, layout);
+  pango_cairo_layout_path(cr, text_shaping_cache_t::shaped(layout));
 }
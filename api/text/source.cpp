@@ -0,0 +1,214 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @author Anthony Matarazzo
+ * @file source.cpp
+ * @date 10/18/26
+ * @version 1.0
+ * @brief versioned text buffer that records edits.
+ */
+// clang-format off
+
+#include <api/text/source.h>
+#include <base/unit_object.h>
+
+// clang-format on
+
+/// @brief copy constructor
+uxdevice::text_source_t::text_source_t(const text_source_t &other) {
+  std::lock_guard lock(other.source_mutex);
+  buffer = other.buffer;
+  current_version = other.current_version.load();
+  history = other.history;
+}
+
+/// @brief copy assignment
+uxdevice::text_source_t &
+uxdevice::text_source_t::operator=(const text_source_t &other) {
+  if (this == &other)
+    return *this;
+
+  std::scoped_lock lock(source_mutex, other.source_mutex);
+  buffer = other.buffer;
+  current_version = other.current_version.load();
+  history = other.history;
+  return *this;
+}
+
+/**
+ * @internal
+ * @fn next_id
+ * @brief issues the identity of a new source. Zero is not issued.
+ * @return std::size_t
+ */
+std::size_t uxdevice::text_source_t::next_id(void) {
+  static std::atomic<std::size_t> counter = 1;
+  return counter++;
+}
+
+/**
+ * @internal
+ * @fn append
+ * @param const std::string_view &s
+ * @brief adds text to the end.
+ */
+void uxdevice::text_source_t::append(const std::string_view &s) {
+  std::lock_guard lock(source_mutex);
+  std::size_t begin = buffer.size();
+  buffer.append(s);
+  record(begin, begin, buffer.size());
+}
+
+/**
+ * @internal
+ * @fn replace
+ * @param std::size_t offset
+ * @param std::size_t length
+ * @param const std::string_view &s
+ * @brief replaces length bytes at offset with the text. An offset past the
+ * end is an error.
+ */
+void uxdevice::text_source_t::replace(std::size_t offset, std::size_t length,
+                                      const std::string_view &s) {
+  std::lock_guard lock(source_mutex);
+  if (offset > buffer.size()) {
+    std::string serror = "text_source_t::replace offset is past the end.";
+    throw std::out_of_range(serror);
+  }
+
+  length = std::min(length, buffer.size() - offset);
+  buffer.replace(offset, length, s);
+  record(offset, offset + length, offset + s.size());
+}
+
+/**
+ * @internal
+ * @fn assign
+ * @param const std::string_view &s
+ * @brief replaces all of the text.
+ */
+void uxdevice::text_source_t::assign(const std::string_view &s) {
+  std::lock_guard lock(source_mutex);
+  std::size_t old_end = buffer.size();
+  buffer.assign(s);
+  record(0, old_end, buffer.size());
+}
+
+/// @overload
+void uxdevice::text_source_t::assign(std::string &&s) {
+  std::lock_guard lock(source_mutex);
+  std::size_t old_end = buffer.size();
+  buffer = std::move(s);
+  record(0, old_end, buffer.size());
+}
+
+/**
+ * @internal
+ * @fn str
+ * @brief a copy of the text.
+ */
+std::string uxdevice::text_source_t::str(void) const {
+  std::lock_guard lock(source_mutex);
+  return buffer;
+}
+
+/**
+ * @internal
+ * @fn record
+ * @brief notes the edit and advances the version. Called with the lock held.
+ */
+void uxdevice::text_source_t::record(std::size_t begin, std::size_t old_end,
+                                     std::size_t new_end) {
+  std::size_t v = current_version + 1;
+  history.emplace_back(text_source_edit_t{v, begin, old_end, new_end});
+  if (history.size() > history_limit)
+    history.pop_front();
+  current_version = v;
+}
+
+/**
+ * @internal
+ * @fn changed_range
+ * @param std::size_t since_version
+ * @param std::size_t &begin
+ * @param std::size_t &end
+ * @brief computes the byte range of the current text that differs from the
+ * text at since_version. The edits are merged in order, each one shifting the
+ * end of the range accumulated so far.
+ * @return bool - false when the history no longer reaches since_version. The
+ * caller should treat the whole text as changed.
+ */
+bool uxdevice::text_source_t::changed_range(std::size_t since_version,
+                                            std::size_t &begin,
+                                            std::size_t &end) const {
+  std::lock_guard lock(source_mutex);
+  return range_since(since_version, begin, end);
+}
+
+/**
+ * @internal
+ * @fn range_since
+ * @param std::size_t since_version
+ * @param std::size_t &begin
+ * @param std::size_t &end
+ * @brief the computation of changed_range. called with the lock held.
+ * @return bool
+ */
+bool uxdevice::text_source_t::range_since(std::size_t since_version,
+                                          std::size_t &begin,
+                                          std::size_t &end) const {
+  begin = end = buffer.size();
+
+  if (since_version == current_version)
+    return true;
+
+  if (since_version > current_version || history.empty() ||
+      history.front().version > since_version + 1)
+    return false;
+
+  bool bempty = true;
+  for (auto &e : history) {
+    if (e.version <= since_version)
+      continue;
+
+    if (bempty) {
+      begin = e.begin;
+      end = e.new_end;
+      bempty = false;
+      continue;
+    }
+
+    /** @brief an end within the replaced bytes moves to the end of the
+     * replacement, one after them moves by the change in length.*/
+    std::size_t shifted_end = end;
+    if (end >= e.old_end)
+      shifted_end = end - e.old_end + e.new_end;
+    else if (end > e.begin)
+      shifted_end = e.new_end;
+
+    begin = std::min(begin, e.begin);
+    end = std::max(shifted_end, e.new_end);
+  }
+
+  /** @brief the range is given within the current text.*/
+  end = std::min(end, buffer.size());
+  begin = std::min(begin, end);
+
+  return true;
+}
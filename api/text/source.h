@@ -0,0 +1,150 @@
+#pragma once
+
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ @author Anthony Matarazzo
+ @file source.h
+ @date 10/18/26
+ @version 1.0
+ @brief versioned text buffer that records edits and a view of text owned
+ by the caller.
+ */
+
+namespace uxdevice {
+
+/**
+ * @internal
+ * @class text_source_edit_t
+ * @brief one edit of a text_source_t. Offsets are in bytes. The range
+ * [begin, old_end) of the prior text was replaced by [begin, new_end).
+ */
+class text_source_edit_t {
+public:
+  std::size_t version = {};
+  std::size_t begin = {};
+  std::size_t old_end = {};
+  std::size_t new_end = {};
+};
+
+/**
+ * @class text_source_t
+ * @brief a text buffer shared between the client and the text_data_t unit.
+ * Each edit increments the version so change detection does not inspect the
+ * text. A short history of edits is kept so a consumer holding an older
+ * version can ask which byte range changed, for example a log view that
+ * appends lines. The text is read under the lock through the read() function.
+ */
+class text_source_t {
+public:
+  text_source_t() {}
+  text_source_t(const std::string &s) : buffer(s) {}
+  text_source_t(std::string &&s) : buffer(std::move(s)) {}
+
+  /// @brief copy constructor
+  text_source_t(const text_source_t &other);
+
+  text_source_t &operator=(const text_source_t &other);
+
+  void append(const std::string_view &s);
+  void replace(std::size_t offset, std::size_t length,
+               const std::string_view &s);
+  void assign(const std::string_view &s);
+  void assign(std::string &&s);
+
+  std::size_t version(void) const noexcept { return current_version; }
+  std::size_t id(void) const noexcept { return source_id; }
+  std::string str(void) const;
+
+  bool changed_range(std::size_t since_version, std::size_t &begin,
+                     std::size_t &end) const;
+
+  /**
+   * @fn read
+   * @tparam FN
+   * @param FN fn - called with a const std::string & and the version.
+   * @brief provides access to the text while the buffer is locked.
+   */
+  template <typename FN> void read(FN fn) const {
+    std::lock_guard lock(source_mutex);
+    fn(buffer, current_version.load());
+  }
+
+  /**
+   * @fn read_changes
+   * @tparam FN
+   * @param std::size_t since_version
+   * @param FN fn - called with a const std::string &, the version, a bool
+   * that is false when the history no longer reaches since_version, and the
+   * begin and end of the changed range within the text.
+   * @brief gives the text with the range changed since since_version under
+   * one lock, so an edit cannot fall between reading the version and the
+   * range.
+   */
+  template <typename FN>
+  void read_changes(std::size_t since_version, FN fn) const {
+    std::lock_guard lock(source_mutex);
+    std::size_t begin = {}, end = {};
+    bool brange = range_since(since_version, begin, end);
+    fn(buffer, current_version.load(), brange, begin, end);
+  }
+
+  static const std::size_t history_limit = 64;
+
+private:
+  void record(std::size_t begin, std::size_t old_end, std::size_t new_end);
+  bool range_since(std::size_t since_version, std::size_t &begin,
+                   std::size_t &end) const;
+  static std::size_t next_id(void);
+
+  mutable std::mutex source_mutex = {};
+  std::string buffer = {};
+  std::atomic<std::size_t> current_version = 1;
+  std::deque<text_source_edit_t> history = {};
+
+  /// @brief unique within the process and never reused, so a consumer that
+  /// notes it is not confused by a later source at the same address. A copy
+  /// receives its own.
+  std::size_t source_id = next_id();
+};
+
+/**
+ * @class text_span_t
+ * @brief text owned outside of the system, such as a memory mapped file or a
+ * producer's buffer. The owner token is held for as long as the span is in
+ * use and keeps the bytes alive. The bytes must not change while the span is
+ * inserted. No copy of the text is made.
+ */
+class text_span_t {
+public:
+  text_span_t() {}
+  text_span_t(const std::string_view &_view,
+              const std::shared_ptr<const void> &_owner)
+      : view(_view), owner(_owner) {}
+
+  /// @brief adopts a string held by shared pointer.
+  text_span_t(const std::shared_ptr<const std::string> &s)
+      : view(*s), owner(s) {}
+
+  std::string_view view = {};
+  std::shared_ptr<const void> owner = {};
+};
+
+
+} // namespace uxdevice
@@ -82,7 +82,11 @@
 
 /// @brief text units
 #include <api/text/alignment.h>
+#include <api/text/atlas.h>
 #include <api/text/color.h>
+#include <api/text/source.h>
+#include <api/text/number_format.h>
+#include <api/text/number.h>
 #include <api/text/data.h>
 #include <api/text/ellipsize.h>
 #include <api/text/fill.h>
@@ -97,4 +101,8 @@
 #include <api/text/tab_stops_storage.h>
 #include <api/text/tab_stops.h>
 
+/// @brief visual that lays out the visible part of large text.
+#include <base/surface/textual_render_virtual_storage.h>
+#include <base/surface/textual_render_virtual.h>
+
 // clang-format on
@@ -37,7 +37,7 @@
  * sequence is as it is input.
  */
 class display_unit_t;
-typedef std::list<std::shared_ptr<display_unit_t>> display_unit_list_t;
+typedef std::vector<std::shared_ptr<display_unit_t>> display_unit_list_t;
 
 /**
  * @class display_list
@@ -53,26 +53,38 @@ struct display_list_t {
    *
    */
   display_unit_list_t display_list_storage = {};
-  display_unit_list_t::iterator itDL_Processed = display_list_storage.begin();
+
+  /// @brief units made by the surface are allocated here. Each clear ends an
+  /// arena epoch, see display_list_clear.
+  std::shared_ptr<unit_arena_t> display_list_arena =
+      std::make_shared<unit_arena_t>();
 
   // interface between client and API rendering threads.
   std::mutex display_list_mutex = {};
 
+  /// @brief units inserted during a batch are held here by the client thread
+  /// and moved to the storage under one lock at commit.
+  bool display_list_batching = false;
+  display_unit_list_t display_list_pending = {};
+
   /**
    * @fn display_list
    * @brief template function to insert into the display list and perform
    * initialization based upon the type. The c++ constexpr conditional compiling
    * functionality is used to trim the run time and code size. One accepts a
-   * constant double reference object in a parampack/
+   * constant double reference object in a parampack/ The unit and its control
+   * block are a single allocation from display_list_arena.
    */
   template <class T, typename... Args>
   std::shared_ptr<T> display_list(const Args &... args) {
-    return display_list<T>(std::make_shared<T>(args...));
+    return display_list<T>(std::allocate_shared<T>(
+        unit_allocator_t<T>(display_list_arena), args...));
   }
 
   template <class T, typename... Args>
   std::shared_ptr<T> display_list(const Args &&... args) {
-    return display_list<T>(std::make_shared<T>(args...));
+    return display_list<T>(std::allocate_shared<T>(
+        unit_allocator_t<T>(display_list_arena), args...));
   }
 
   /**
@@ -81,18 +93,53 @@ struct display_list_t {
    */
   template <class T>
   std::shared_ptr<T> display_list(const std::shared_ptr<T> ptr) {
+    if (display_list_batching) {
+      display_list_pending.emplace_back(ptr);
+      return ptr;
+    }
+
     std::lock_guard<std::mutex> lock(display_list_mutex);
     display_list_storage.emplace_back(ptr);
     return ptr;
   }
 
+  /**
+   * @fn display_list_batch_begin
+   * @brief further insertions are pended until display_list_batch_commit.
+   */
+  void display_list_batch_begin(void) { display_list_batching = true; }
+
+  /**
+   * @fn display_list_batch_commit
+   * @brief appends the pended units in one lock acquisition.
+   */
+  void display_list_batch_commit(void) {
+    display_list_batching = false;
+    if (display_list_pending.empty())
+      return;
+
+    std::lock_guard<std::mutex> lock(display_list_mutex);
+    display_list_storage.insert(
+        display_list_storage.end(),
+        std::make_move_iterator(display_list_pending.begin()),
+        std::make_move_iterator(display_list_pending.end()));
+    display_list_pending.clear();
+  }
+
   /**
    * @fn display_list_clear
-   * @brief
+   * @brief empties the display list and ends the arena epoch. When no unit
+   * of the epoch is still referenced the pools are returned at once.
+   * Otherwise the surface moves to a new arena and the old one, held by the
+   * allocators of its remaining units, returns its memory to the system when
+   * the last of them is released, possibly on the render thread.
    */
   void display_list_clear(void) {
     std::lock_guard<std::mutex> lock(display_list_mutex);
     display_list_storage.clear();
+    display_list_pending.clear();
+    if (!display_list_arena->release())
+      display_list_arena = std::make_shared<unit_arena_t>();
   }
 };
 }
@@ -0,0 +1,96 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @author Anthony Matarazzo
+ * @file display_list_bench.cpp
+ * @date 10/18/26
+ * @version 1.0
+ * @brief iteration and rebuild cost of the display list storage, the
+ * std::vector of display_unit_list_t against the std::list it replaced.
+ * @details standalone program, not part of the library. Build it with the
+ * library sources, for example
+ *
+ *   g++ -std=c++17 -O2 -I. base/display_list_bench.cpp <library objects>
+ *   $(pkg-config --cflags --libs pangocairo xcb xcb-shm xcb-keysyms
+ *   x11-xcb librsvg-2.0)
+ *
+ * and run as display_list_bench [units] [passes]. Each pass walks the list
+ * the way the render pipeline does, testing each unit for change. The
+ * rebuild measures a clear followed by appending every unit again.
+ */
+// clang-format off
+
+#include <base/unit_object.h>
+
+// clang-format on
+
+int main(int argc, char **argv) {
+  using namespace uxdevice;
+
+  const std::size_t units =
+      argc > 1 ? static_cast<std::size_t>(std::max(std::atoi(argv[1]), 1))
+               : 100000;
+  const int passes = argc > 2 ? std::max(std::atoi(argv[2]), 1) : 200;
+
+  auto arena = std::make_shared<unit_arena_t>();
+  std::vector<std::shared_ptr<display_unit_t>> source = {};
+  source.reserve(units);
+  for (std::size_t i = 0; i < units; i++) {
+    source.emplace_back(std::allocate_shared<display_unit_t>(
+        unit_allocator_t<display_unit_t>(arena)));
+    source.back()->is_processed = i % 3 == 0;
+  }
+
+  auto measure = [&](const char *name, auto &storage) {
+    std::size_t changed = {};
+    auto start = std::chrono::steady_clock::now();
+
+    for (int p = 0; p < passes; p++)
+      for (auto &n : storage)
+        if (!n->is_processed || n->has_changed())
+          changed++;
+
+    std::chrono::duration<double> walk =
+        std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int p = 0; p < passes; p++) {
+      storage.clear();
+      for (auto &n : source)
+        storage.emplace_back(n);
+    }
+
+    std::chrono::duration<double> rebuild =
+        std::chrono::steady_clock::now() - start;
+    double count = static_cast<double>(passes) * units;
+
+    std::cout << name << ": walk " << count / walk.count() << " units/s, "
+              << "rebuild " << count / rebuild.count() << " units/s ("
+              << changed << " changed)" << std::endl;
+  };
+
+  std::list<std::shared_ptr<display_unit_t>> list_storage(source.begin(),
+                                                          source.end());
+  measure("std::list", list_storage);
+
+  display_unit_list_t vector_storage(source.begin(), source.end());
+  measure("display_unit_list_t", vector_storage);
+
+  return 0;
+}
@@ -57,6 +57,7 @@ class storage_emitter_t : virtual public hash_members_t,
 public:
   storage_emitter_t() : value(TS{}) {}
   storage_emitter_t(const TS &o) : value(o) {}
+  storage_emitter_t(TS &&o) : value(std::move(o)) {}
   virtual ~storage_emitter_t() {}
 
   /// @brief copy constructor
@@ -67,7 +68,8 @@ public:
   /// @brief move constructor
   storage_emitter_t(storage_emitter_t &&other) noexcept
       : hash_members_t(other), system_error_t(other),
-        display_unit_t(other), typed_index_t<T>(other), value(other.value) {}
+        display_unit_t(other), typed_index_t<T>(other),
+        value(std::move(other.value)) {}
 
   /// @brief copy assignment operator
   storage_emitter_t &operator=(const storage_emitter_t &other) {
@@ -85,7 +87,7 @@ public:
     system_error_t::operator=(other);
     display_unit_t::operator=(other);
     typed_index_t<T>::operator=(other);
-    value = other.other;
+    value = std::move(other.value);
     return *this;
   }
   /**
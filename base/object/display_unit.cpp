@@ -70,7 +70,10 @@ uxdevice::display_unit_t::operator=(const display_unit_t &other) {
   return *this;
 }
 
-void uxdevice::display_unit_t::changed(void) { bchanged = true; }
+void uxdevice::display_unit_t::changed(void) {
+  bchanged = true;
+  hash_invalidate();
+}
 
 bool uxdevice::display_unit_t::has_changed(void) { return is_different_hash(); }
 
@@ -157,7 +157,10 @@ std::size_t uxdevice::display_visual_t::hash_code(void) const noexcept {
  * @brief
  *
  */
-void uxdevice::display_visual_t::changed(void) { bchanged = true; }
+void uxdevice::display_visual_t::changed(void) {
+  bchanged = true;
+  hash_invalidate();
+}
 
 /**
  * @internal
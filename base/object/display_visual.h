@@ -141,14 +141,19 @@ public:
   cairo_rectangle_t ink_rectangle_double = cairo_rectangle_t();
   cairo_rectangle_int_t intersection_int = cairo_rectangle_int_t();
   cairo_rectangle_t intersection_double = cairo_rectangle_t();
+
+  /// @brief the ink rectangle when last seen by plot on the render thread.
+  /// A difference makes the display context hit index stale.
+  cairo_rectangle_int_t hit_ink_rectangle = cairo_rectangle_int_t();
 };
 
 /**
  * @internal
  * @typedef display_visual_list_t
  * @brief used to hold the list of visual. the display context uses this type.
- *
+ * The storage is contiguous as plot walks it for each region. Items are only
+ * appended or cleared so a position remains valid while walking.
  */
-typedef std::list<std::shared_ptr<display_visual_t>> display_visual_list_t;
+typedef std::vector<std::shared_ptr<display_visual_t>> display_visual_list_t;
 
 } // namespace uxdevice
@@ -34,15 +34,91 @@ namespace uxdevice {
  * @param ... - variadic parameter expanding to hash combine each listed.
  * @brief Creates interface routines for the hashing system and change detection
  * logic. Hashes each of the listed values within the  parameters.
+ * @details The generation is advanced by hash_invalidate() once a change to
+ * the object is complete, never before it, so a hash computed while the change
+ * is being made is not kept under the new generation. Change detection
+ * compares generations and the hash value is computed again only when the
+ * generation differs from the cached one. Objects
+ * that can be modified without notification, such as data shared with the
+ * caller through a pointer, return true from hash_volatile() and are hashed on
+ * each test.
  */
 class hash_members_t {
 public:
   hash_members_t() {}
   virtual ~hash_members_t() {}
+
+  /// @brief copy constructor
+  hash_members_t(const hash_members_t &other)
+      : __used_hash_code(other.__used_hash_code),
+        __used_hash_generation(other.__used_hash_generation),
+        __hash_volatile(other.__hash_volatile),
+        __hash_generation(other.__hash_generation.load()) {}
+
+  /// @brief copy assignment operator
+  hash_members_t &operator=(const hash_members_t &other) {
+    __used_hash_code = other.__used_hash_code;
+    __used_hash_generation = other.__used_hash_generation;
+    __hash_volatile = other.__hash_volatile;
+    __hash_generation = other.__hash_generation.load();
+    std::lock_guard lock(__cached_hash_mutex);
+    __cached_hash_generation = {};
+    return *this;
+  }
+
   virtual std::size_t hash_code(void) const noexcept = 0;
+
+  /// @brief objects combining the state of others, such as visuals and their
+  /// linked attributes, override these to include the others.
+  virtual std::size_t hash_generation(void) const noexcept {
+    return __hash_generation;
+  }
+  virtual bool hash_volatile(void) const noexcept { return __hash_volatile; }
+
+  void hash_invalidate(void) noexcept { __hash_generation++; }
+
+  /// @brief the client and the render thread both ask for the hash. The code
+  /// and its generation are read and stored together under the lock, which is
+  /// not held while hashing. A code computed for an older generation may
+  /// replace a newer one, it is then computed again by the next caller.
+  std::size_t cached_hash_code(void) const noexcept {
+    std::size_t generation = hash_generation();
+    bool bvolatile = hash_volatile();
+    if (!bvolatile) {
+      std::lock_guard lock(__cached_hash_mutex);
+      if (generation == __cached_hash_generation)
+        return __cached_hash_code;
+    }
+
+    std::size_t value = hash_code();
+    if (!bvolatile) {
+      std::lock_guard lock(__cached_hash_mutex);
+      __cached_hash_code = value;
+      __cached_hash_generation = generation;
+    }
+    return value;
+  }
+
+  void state_hash_code(void) {
+    __used_hash_generation = hash_generation();
+    __used_hash_code = cached_hash_code();
+  }
+
+  bool is_different_hash() {
+    if (hash_generation() != __used_hash_generation)
+      return true;
+    return hash_volatile() && hash_code() != __used_hash_code;
+  }
+
   std::size_t __used_hash_code = {};
-  void state_hash_code(void) { __used_hash_code = hash_code(); }
-  bool is_different_hash() { return hash_code() != __used_hash_code; }
+  std::size_t __used_hash_generation = {};
+  bool __hash_volatile = {};
+
+private:
+  std::atomic<std::size_t> __hash_generation = 1;
+  mutable std::mutex __cached_hash_mutex = {};
+  mutable std::size_t __cached_hash_code = {};
+  mutable std::size_t __cached_hash_generation = {};
 };
 
 /**
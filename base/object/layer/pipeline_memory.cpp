@@ -180,6 +180,43 @@ uxdevice::pipeline_memory_t::pipeline_memory_hash_code(void) const noexcept {
   return value;
 }
 
+/**
+ * @internal
+ * @fn pipeline_memory_hash_generation
+ * @brief combines the identity of each stored object, its type and address,
+ * with its generation. Replacing an object with another of the same
+ * generation, or advancing one while another is reset, changes the value as
+ * a sum of the generations would not. The combined terms are added so the
+ * value does not depend on the iteration order of the storage.
+ */
+std::size_t uxdevice::pipeline_memory_t::pipeline_memory_hash_generation(
+    void) const noexcept {
+  std::size_t value = {};
+  for (auto &n : storage) {
+    std::size_t member = n.first.hash_code();
+    if (n.second.hash_members)
+      hash_combine(member, n.second.hash_members,
+                   n.second.hash_members->hash_generation());
+    value += member;
+  }
+
+  return value;
+}
+
+/**
+ * @internal
+ * @fn pipeline_memory_hash_volatile
+ * @brief true if any of the stored objects must be hashed to detect change.
+ */
+bool uxdevice::pipeline_memory_t::pipeline_memory_hash_volatile(
+    void) const noexcept {
+  for (auto &n : storage)
+    if (n.second.hash_members && n.second.hash_members->hash_volatile())
+      return true;
+
+  return false;
+}
+
 /**
  * @fn std::size_t pipeline_fn_sequence(const visitor_interface_t*)
  * @brief builds the sequence number from a visitor interface object
@@ -167,6 +167,11 @@ public:
   /// item.
   std::size_t pipeline_memory_hash_code(void) const noexcept;
 
+  /// @brief change generation and volatility of the stored objects. Used by
+  /// visuals to detect changes of linked attributes without hashing them.
+  std::size_t pipeline_memory_hash_generation(void) const noexcept;
+  bool pipeline_memory_hash_volatile(void) const noexcept;
+
   /**
    * @fn pipeline_disable_visit
    * @tparam T
@@ -192,6 +197,7 @@ public:
     std::size_t _associated_bits = object_data_storage_bits;
     accepted_interfaces_storage_t *_accepted_interfaces = {};
     hash_function_t _hash_fn = {};
+    const hash_members_t *_hash_members = {};
 
     /** @brief the target visitor pattern the object supports. the default is
      * object_data_storage_bits. These are linkages used by the object
@@ -205,13 +211,16 @@ public:
     if constexpr (std::is_base_of<accepted_interfaces_base_t, T>::value)
       _accepted_interfaces = &ptr->accepted_interfaces;
 
-    /** @brief object supports a hashing interface*/
-    if constexpr (std::is_base_of<hash_members_t, T>::value)
-      _hash_fn = [&]() { return ptr->hash_code(); };
+    /** @brief object supports a hashing interface. The hash is computed
+     * again only when the object has changed.*/
+    if constexpr (std::is_base_of<hash_members_t, T>::value) {
+      _hash_fn = [ptr]() { return ptr->cached_hash_code(); };
+      _hash_members = ptr.get();
+    }
 
     /** @brief place into unordered map as a visitor object shared_ptr */
-    storage[ti] = pipeline_memory_object_t{ptr, _associated_bits,
-                                           _accepted_interfaces, _hash_fn};
+    storage[ti] = pipeline_memory_object_t{
+        ptr, _associated_bits, _accepted_interfaces, _hash_fn, _hash_members};
   }
 
   /**
@@ -387,7 +396,10 @@ public:
       /** @brief this part of the mechanism can be increased by combining hash
        * keys of the dual information required. todo add an unordered map of
        * storage index. */
-      for (auto o : storage)
+      for (auto o : storage) {
+        if (o.first == pipeline_visit_excluded)
+          continue;
+
         /** @brief this subtle logic uses an operator overload within the
          * o.second[] call. This search the object for the fn_emit_SIGNATURE by
          * type index. Essentially encapsulating the find against the accepted
@@ -395,15 +407,35 @@ public:
         if (auto v = o.second[ti])
           pipeline_io.emplace_back(
               std::make_tuple(pipeline_fn_sequence(v), v->fn));
+      }
 
     // ensure this will be sorted before executed.
     bfinalized = false;
   }
 
+  /**
+   * @internal
+   * @fn pipeline_push_visit_except
+   * @tparam T - the stored object that is not emitted.
+   * @tparam Args... the fn_emit_SIGNATURES as pipeline_push_visit.
+   * @brief as pipeline_push_visit while skipping the object stored for T. It
+   * remains available through pipeline_memory_access, for an object that
+   * consumes it itself.
+   */
+  template <typename T, typename... Args>
+  void pipeline_push_visit_except(void) {
+    pipeline_visit_excluded = std::type_index(typeid(T));
+    pipeline_push_visit<Args...>();
+    pipeline_visit_excluded = std::type_index(typeid(void));
+  }
+
   /// @brief public variables
   bool bfinalized = false;
   pipeline_memory_storage_t storage = {};
   pipeline_fn_sequence_storage_t pipeline_fn_sequence_storage = {};
   pipeline_t pipeline_io = {};
+
+private:
+  std::type_index pipeline_visit_excluded = std::type_index(typeid(void));
 }; // namespace uxdevice
 } // namespace uxdevice
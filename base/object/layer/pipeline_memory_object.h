@@ -49,23 +49,46 @@ public:
 
   pipeline_memory_object_t(std::any _o, std::size_t _bits,
                            accepted_interfaces_storage_t *_accepted_interfaces,
-                           const hash_function_t _hash_function);
-  /// @brief copy assignment operator
+                           const hash_function_t _hash_function,
+                           const hash_members_t *_hash_members = nullptr)
+      : object(_o), visitor_target_bits(_bits),
+        accept_interfaces(_accepted_interfaces), hash_function(_hash_function),
+        hash_members(_hash_members) {}
+
+  /// @brief copy assignment operator. The data mutex is not copied.
   pipeline_memory_object_t &operator=(const pipeline_memory_object_t &other) {
+    object = other.object;
+    visitor_target_bits = other.visitor_target_bits;
+    accept_interfaces = other.accept_interfaces;
+    hash_function = other.hash_function;
+    hash_members = other.hash_members;
     return *this;
   }
 
   /// @brief move assignment
   pipeline_memory_object_t &
   operator=(pipeline_memory_object_t &&other) noexcept {
+    object = std::move(other.object);
+    visitor_target_bits = other.visitor_target_bits;
+    accept_interfaces = other.accept_interfaces;
+    hash_function = std::move(other.hash_function);
+    hash_members = other.hash_members;
     return *this;
   }
 
   /// @brief move constructor
-  pipeline_memory_object_t(pipeline_memory_object_t &&other) noexcept {}
+  pipeline_memory_object_t(pipeline_memory_object_t &&other) noexcept
+      : object(std::move(other.object)),
+        visitor_target_bits(other.visitor_target_bits),
+        accept_interfaces(other.accept_interfaces),
+        hash_function(std::move(other.hash_function)),
+        hash_members(other.hash_members) {}
 
   /// @brief copy constructor
-  pipeline_memory_object_t(const pipeline_memory_object_t &other) {}
+  pipeline_memory_object_t(const pipeline_memory_object_t &other)
+      : object(other.object), visitor_target_bits(other.visitor_target_bits),
+        accept_interfaces(other.accept_interfaces),
+        hash_function(other.hash_function), hash_members(other.hash_members) {}
 
   /** @brief [] operator reduces syntax*/
   visitor_interface_t *operator[](std::type_index ti) noexcept {
@@ -82,4 +105,8 @@ public:
   std::size_t visitor_target_bits = {};
   accepted_interfaces_storage_t *accept_interfaces = {};
   hash_function_t hash_function = {};
+
+  /// @brief the change generation of the object, owned by the shared pointer
+  /// within object.
+  const hash_members_t *hash_members = {};
 };
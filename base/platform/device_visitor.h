@@ -112,8 +112,8 @@ public:
    * @brief The alias is a signature that provides meaning to the information
    * that is specific to how the system will interpret it. These are names
    * within the API such as listen_mousemove_t. The data is kept as unit along
-   * with the alias.*/
-  std::type_index alias = std::type_index(typeid(this));
+   * with the alias. none marks a message which raises no event.*/
+  event_id_t alias = event_id_t::none;
 
   /**
    * @internal
@@ -26,27 +26,85 @@
 */
 
 namespace uxdevice {
+
+/**
+ * @internal
+ * @class message_coalesce_counters_t
+ * @brief number of messages removed by fn_coalesce_messages, by kind.
+ */
+class message_coalesce_counters_t {
+public:
+  std::atomic<std::size_t> motion = {};
+  std::atomic<std::size_t> expose = {};
+  std::atomic<std::size_t> configure = {};
+};
+
+/**
+ * @internal
+ * @enum message_threading_t
+ * @brief threaded gives the message loop, the event dispatcher and the
+ * renderer a thread each. reactor runs the three from one thread that waits
+ * on the os connection, the render wake and a frame timer together. It is
+ * set as a window parameter.
+ */
+enum class message_threading_t { threaded, reactor };
+
 template <typename T> class message_queue_t {
 public:
-  message_queue_t() {
+  message_queue_t() {}
+
+  /**
+   * @internal
+   * @fn start_threads
+   * @brief starts the message monitor and queued block dispatch threads.
+   * Not used when threading is reactor.
+   */
+  void start_threads(void) {
+    bProcessing = true;
+
     /// @brief start message monitor and queued block dispatch.
-    std::thread message_queue_thread([=]() {
-      bProcessing = true;
-      message_loop();
-    });
+    std::thread message_queue_thread([=]() { message_loop(); });
 
     message_queue_thread.detach();
 
-    /// @brief start queue dispatcher. THis uses a condition variable while
+    /// @brief start queue dispatcher. This waits on a wake event while
     /// blocks are input. messages are processed here serially and filtered.
-    std::thread event_queue_thread([=]() {
-      bProcessing = true;
-      event_queue_processor();
-    });
+    std::thread event_queue_thread([=]() { event_queue_processor(); });
 
     event_queue_thread.detach();
   }
 
+  /**
+   * @internal
+   * @fn reactor_attach
+   * @param event_reactor_t &reactor
+   * @brief watches the os connection within the reactor. Messages are
+   * gathered and dispatched on the reactor thread.
+   */
+  void reactor_attach(event_reactor_t &reactor) {
+    bProcessing = true;
+    reactor.watch(fn_message_descriptor(), [&]() { dispatch_available(true); });
+  }
+
+  /**
+   * @internal
+   * @fn dispatch_available
+   * @param bool read - the connection is read, otherwise only messages
+   * already read by the os library are taken.
+   * @brief gathers the messages that can be had without waiting and
+   * dispatches them as one batch.
+   */
+  void dispatch_available(bool read) {
+    std::deque<T> batch = {};
+    T msg = {};
+
+    while (bProcessing && (msg = read ? fn_read_message() : fn_poll_message()))
+      batch.emplace_back(msg);
+
+    if (!batch.empty())
+      dispatch_batch(batch);
+  }
+
   ~message_queue_t() { bProcessing = false; }
 
   /**
@@ -69,6 +127,23 @@ public:
    */
   virtual T fn_poll_message(void) = 0;
 
+  /**
+   * @internal
+   * @fn fn_read_message
+   * @brief reads the os connection without waiting and returns a message,
+   * or null when none has arrived. Used by the reactor once its descriptor
+   * is readable.
+   */
+  virtual T fn_read_message(void) { return fn_poll_message(); }
+
+  /**
+   * @internal
+   * @fn fn_message_descriptor
+   * @brief the descriptor of the os connection which becomes readable as
+   * messages arrive.
+   */
+  virtual int fn_message_descriptor(void) = 0;
+
   /**
    * @internal
    * @fn void complete_message(void)=0
@@ -104,6 +179,17 @@ public:
    */
   virtual void fn_visit_dispatch(T msg) = 0;
 
+  /**
+   * @internal
+   * @fn fn_coalesce_messages
+   * @param std::deque<T> &batch
+   * @brief called with each gathered batch before dispatch. The os
+   * implementation may merge messages that supersede one another, such as
+   * pointer motion, and must complete the ones it removes. The count of
+   * removed messages is added to coalesce_counters.
+   */
+  virtual void fn_coalesce_messages(std::deque<T> &batch) {}
+
   /**
    * @internal
    * @fn message_loop
@@ -127,17 +213,14 @@ public:
      * some priorities in queue processing go to window services to resize
      * surface first and output the new area background. */
     while (bProcessing && (msg = fn_message_wait())) {
-      {
-        std::lock_guard lock(event_queue_mutex);
-        event_queue.emplace_back(msg);
+      event_queue_push(msg);
 
-        // qt5 does this, it queues all of the input messages at once.
-        // this makes the processing of painting and reading input faster.
-        while (bProcessing && (msg = fn_poll_message()))
-          event_queue.emplace_back(msg);
-      }
+      // qt5 does this, it queues all of the input messages at once.
+      // this makes the processing of painting and reading input faster.
+      while (bProcessing && (msg = fn_poll_message()))
+        event_queue_push(msg);
 
-      event_queue_condition_variable.notify_one();
+      event_queue_wake.signal();
     }
   }
 
@@ -145,58 +228,121 @@ public:
    * @fn void event_queue_processor(void)
    * @brief thread dispatches queued messages from from window manager. This
    * thread processes these filter message when a block is received. Perhaps
-   * one, or more. At times the processing style saves and reflects screen
-   * changes quicker due to the condition variable and queued approach.
+   * one, or more. The wake keeps a count so a signal given while a batch is
+   * dispatched is seen by the next wait.
    *
    */
   void event_queue_processor(void) {
+    std::deque<T> batch = {};
+    std::deque<std::chrono::steady_clock::time_point> queued = {};
+
     while (bProcessing) {
-      bool bdone = {};
+      event_queue_wake.wait();
 
-      // wait until messages are queued and the signal is received.
-      std::unique_lock<std::mutex> lk(event_queue_condition_mutex);
-      event_queue_condition_variable.wait(lk);
-      lk.unlock();
+      /// @brief take all of the gathered messages at once so that those
+      /// superseded within the batch are merged before any is dispatched.
+      event_queue_take(batch, queued);
+      if (batch.empty())
+        continue;
 
-      {
-        std::lock_guard lock(event_queue_mutex);
-        if (event_queue.empty())
-          bdone = true;
-      }
+      /// @brief the delay from each message being queued to the dispatch of
+      /// its batch.
+      auto now = std::chrono::steady_clock::now();
+      for (auto &t : queued)
+        dispatch_latency.record(now - t);
+      queued.clear();
 
-      T msg = {};
+      dispatch_batch(batch);
+    }
+  }
 
-      while (!bdone) {
-        // get message
-        {
-          std::lock_guard lock(event_queue_mutex);
-          msg = event_queue.front();
-          event_queue.pop_front();
-        }
+  /**
+   * @internal
+   * @fn dispatch_batch
+   * @param std::deque<T> &batch
+   * @brief merges superseded messages, dispatches the rest and completes
+   * each. The batch is empty on return.
+   */
+  void dispatch_batch(std::deque<T> &batch) {
+    fn_coalesce_messages(batch);
 
+    for (auto msg : batch) {
+      if (bProcessing)
         // invoke the search
         fn_visit_dispatch(msg);
 
-        // free is here - is odd, pointer should be managed at allocation level
-        fn_complete_message(msg);
-
-        // check for next iteration.
-        {
-          std::lock_guard lock(event_queue_mutex);
-          if (event_queue.empty())
-            bdone = true;
-          else if (!bProcessing)
-            bdone = true;
-        }
-      }
+      // free is here - is odd, pointer should be managed at allocation level
+      fn_complete_message(msg);
+    }
+
+    batch.clear();
+  }
+
+  /**
+   * @internal
+   * @fn event_queue_push
+   * @param T msg
+   * @brief producer side, the message loop thread. Once the ring has filled,
+   * messages go to the overflow list until the consumer empties it so that
+   * order is kept.
+   */
+  void event_queue_push(T msg) {
+    queued_message_t item = {msg, std::chrono::steady_clock::now()};
+
+    if (!event_overflow_active.load(std::memory_order_acquire) &&
+        event_queue.push(item))
+      return;
+
+    std::lock_guard lock(event_overflow_mutex);
+    event_overflow.emplace_back(item);
+    event_overflow_active.store(true, std::memory_order_release);
+  }
+
+  /**
+   * @internal
+   * @fn event_queue_take
+   * @brief consumer side. The ring holds the older messages, the overflow
+   * the newer.
+   */
+  void event_queue_take(std::deque<T> &batch,
+                        std::deque<std::chrono::steady_clock::time_point> &q) {
+    queued_message_t item = {};
+
+    while (event_queue.pop(item)) {
+      batch.emplace_back(item.msg);
+      q.emplace_back(item.queued);
+    }
+
+    if (!event_overflow_active.load(std::memory_order_acquire))
+      return;
+
+    std::lock_guard lock(event_overflow_mutex);
+    for (auto &n : event_overflow) {
+      batch.emplace_back(n.msg);
+      q.emplace_back(n.queued);
     }
+    event_overflow.clear();
+    event_overflow_active.store(false, std::memory_order_release);
   }
 
+  /// @brief a message and the time it was queued.
+  class queued_message_t {
+  public:
+    T msg = {};
+    std::chrono::steady_clock::time_point queued = {};
+  };
+
   std::atomic<bool> bProcessing = false;
-  std::mutex event_queue_mutex = {};
-  std::list<T> event_queue = {};
-  std::mutex event_queue_condition_mutex = {};
-  std::condition_variable event_queue_condition_variable = {};
+  message_threading_t threading = message_threading_t::threaded;
+  mpsc_ring_t<queued_message_t, 1024> event_queue = {};
+  std::atomic<bool> event_overflow_active = false;
+  std::mutex event_overflow_mutex = {};
+  std::deque<queued_message_t> event_overflow = {};
+  wake_event_t event_queue_wake = {};
+
+  /// @brief time from a message being queued to its dispatch.
+  latency_histogram_t dispatch_latency = {};
+  message_coalesce_counters_t coalesce_counters = {};
 };
 
 } // namespace uxdevice
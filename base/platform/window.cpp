@@ -123,6 +123,7 @@ void set(const painter_brush_t _brush) {
 void uxdevice::window_manager_base_t::draw_fn(
     const std::function<void(cairo_t *)> &fn) {
   std::lock_guard<std::mutex> guard(cr_mutex);
+  fn_acquire_surface(surface);
   fn(cr);
   error_check(cr);
 }
@@ -137,6 +138,7 @@ void uxdevice::window_manager_base_t::draw_fn(
 void uxdevice::window_manager_base_t::surface_fn(
     const std::function<void(cairo_surface_t *)> &fn) {
   std::lock_guard lock(surface_mutex);
+  fn_acquire_surface(surface);
   fn(surface);
   error_check(surface);
 }
@@ -153,6 +155,44 @@ void uxdevice::window_manager_base_t::video_flush(void) {
     if (surface) {
       cairo_surface_flush(surface);
       error_check(surface);
+      fn_present_surface(surface, 0, 0, window_width, window_height);
+    }
+  }
+  flush_window();
+}
+
+/**
+ * @fn void video_flush(const cairo_region_t *)
+ * @overload
+ * @brief presents only the damaged areas of the surface. A region made of
+ * many small rectangles is sent as its extents as the request overhead
+ * outweighs the pixels.
+ *
+ * @param damage
+ */
+void uxdevice::window_manager_base_t::video_flush(
+    const cairo_region_t *damage) {
+  static const int rectangle_limit = 16;
+  {
+    std::lock_guard lock(surface_mutex);
+
+    if (surface) {
+      cairo_surface_flush(surface);
+      error_check(surface);
+
+      cairo_rectangle_int_t r = {};
+      int n = cairo_region_num_rectangles(damage);
+
+      if (n > rectangle_limit) {
+        cairo_region_get_extents(damage, &r);
+        fn_present_surface(surface, r.x, r.y, r.width, r.height);
+
+      } else {
+        for (int i = 0; i < n; i++) {
+          cairo_region_get_rectangle(damage, i, &r);
+          fn_present_surface(surface, r.x, r.y, r.width, r.height);
+        }
+      }
     }
   }
   flush_window();
@@ -182,45 +222,190 @@ void uxdevice::window_manager_base_t::allocate_base() {
   }
 
   window_open = true;
+  surface_capacity_width = window_width;
+  surface_capacity_height = window_height;
 
   cairo_surface_flush(surface);
 }
 
-/**
- *
- */
-void uxdevice::window_manager_base_t::start_threads(void) {}
-
 /**
  * @fn resize_surface
  * @brief holds the mutex and calls the os function spllied within its
  * implementation. Some surface handlers within the cairo system can be managed
  * within a resize function such as xcb rather than destroy and recreating it.
+ * A request that follows the prior one within surface_settle_time is part of
+ * an interactive resize.
  */
-void uxdevice::window_manager_base_t::resize_surface(const int w.const int h) {
+void uxdevice::window_manager_base_t::resize_surface(const int w,
+                                                     const int h) {
   std::lock_guard lock(surface_requests_storage_mutex);
+  auto now = std::chrono::steady_clock::now();
+
+  if (now - surface_request_time < surface_settle_time)
+    surface_settle_pending = true;
+  surface_request_time = now;
+
   if (w != window_width || h != window_height)
-    surface_requests_storage.emplace_back(w, h);
+    surface_request.emplace(w, h);
+}
+
+/**
+ * @internal
+ * @fn surface_request_waiting
+ * @brief a size has been requested and not yet applied.
+ */
+bool uxdevice::window_manager_base_t::surface_request_waiting(void) {
+  std::lock_guard lock(surface_requests_storage_mutex);
+  return surface_request.has_value();
+}
+
+/**
+ * @internal
+ * @fn surface_settle_due
+ * @brief the time at which an interactive resize is considered finished.
+ * The render thread waits until then when there is no other work.
+ */
+std::optional<std::chrono::steady_clock::time_point>
+uxdevice::window_manager_base_t::surface_settle_due(void) {
+  std::lock_guard lock(surface_requests_storage_mutex);
+  if (!surface_settle_pending)
+    return {};
+  return surface_request_time + surface_settle_time;
 }
 
 /**
  * @internal
  * @fn void apply_surface_requests(void)
- * @brief The routine applies resize requests of a window. The underlying
- * cairo surface is sized with the very last one.
+ * @brief The routine applies resize requests of a window. The window size
+ * is taken from the very last one. During an interactive resize the surface
+ * only grows, rounded up to surface_growth_step, so a drag does not allocate
+ * per pixel. The frame shown is scaled to each new size. Once no request
+ * has arrived for surface_settle_time, the surface is fitted to the exact
+ * window size and the caller repaints once. A lone resize is applied at the
+ * exact size at once.
+ * @return bool - true when the window should be repainted entirely.
  */
-void uxdevice::window_manager_base_t::apply_surface_requests(void) {
+bool uxdevice::window_manager_base_t::apply_surface_requests(void) {
   std::scoped_lock lock(surface_requests_storage_mutex, surface_mutex);
+  auto step_up = [](int n) {
+    return (std::max(n, 1) + surface_growth_step - 1) / surface_growth_step *
+           surface_growth_step;
+  };
 
-  if (surface_requests_storage.empty())
-    return;
+  if (surface_request) {
+    auto flat = *surface_request;
+    surface_request.reset();
+
+    int from_w = window_width;
+    int from_h = window_height;
+    window_width = flat.w;
+    window_height = flat.h;
 
-  auto flat = surface_requests_storage.back();
-  surface_requests_storage.clear();
+    if (!surface_settle_pending) {
+      surface_reallocate(flat.w, flat.h, from_w, from_h);
+      return true;
+    }
 
+    if (flat.w > surface_capacity_width || flat.h > surface_capacity_height)
+      surface_reallocate(step_up(std::max(flat.w, surface_capacity_width)),
+                         step_up(std::max(flat.h, surface_capacity_height)),
+                         from_w, from_h);
+    else if (from_w > 0 && from_h > 0)
+      surface_scale(from_w, from_h);
+  }
+
+  if (!surface_settle_pending ||
+      std::chrono::steady_clock::now() - surface_request_time <
+          surface_settle_time)
+    return false;
+
+  surface_settle_pending = false;
+
+  if (window_width != surface_capacity_width ||
+      window_height != surface_capacity_height)
+    surface_reallocate(window_width, window_height, window_width,
+                       window_height);
+  return true;
+}
+
+/**
+ * @internal
+ * @fn surface_reallocate
+ * @param const int w - new surface width.
+ * @param const int h - new surface height.
+ * @param const int from_w - window width the current frame was drawn at.
+ * @param const int from_h - window height the current frame was drawn at.
+ * @brief sizes the surface through the os. The previous frame is scaled
+ * from the prior window size to the current one so that a resize shows the
+ * old contents rather than blank areas until the repaint. When the os
+ * returns a new surface the old one is the source. A surface resized in
+ * place, such as an xcb window surface, still holds the frame at its prior
+ * size, which is copied out and scaled back onto it. Called with the
+ * surface_mutex held.
+ */
+void uxdevice::window_manager_base_t::surface_reallocate(const int w,
+                                                         const int h,
+                                                         const int from_w,
+                                                         const int from_h) {
   cairo_surface_flush(surface);
-  fn_resize_surface(surface, flat.w, flat.h);
+  cairo_surface_t *resized = fn_resize_surface(surface, w, h);
+  surface_capacity_width = w;
+  surface_capacity_height = h;
+
+  if (!resized)
+    return;
+
+  if (resized == surface) {
+    if (from_w > 0 && from_h > 0 &&
+        (from_w != window_width || from_h != window_height))
+      surface_scale(from_w, from_h);
+    return;
+  }
+
+  std::lock_guard lock(cr_mutex);
+  cairo_t *next = cairo_create(resized);
+
+  if (from_w > 0 && from_h > 0) {
+    cairo_save(next);
+    cairo_scale(next, static_cast<double>(window_width) / from_w,
+                static_cast<double>(window_height) / from_h);
+    cairo_set_source_surface(next, surface, 0, 0);
+    cairo_paint(next);
+    cairo_restore(next);
+  }
+
+  cairo_destroy(cr);
+  cr = next;
+  cairo_surface_destroy(surface);
+  surface = resized;
+}
+
+/**
+ * @internal
+ * @fn surface_scale
+ * @param const int from_w - window width the current frame was drawn at.
+ * @param const int from_h - window height the current frame was drawn at.
+ * @brief scales the frame held by the surface from the prior window size to
+ * the current one, in place. The frame is copied out first as cairo cannot
+ * read and write the same surface. Called with the surface_mutex held.
+ */
+void uxdevice::window_manager_base_t::surface_scale(const int from_w,
+                                                    const int from_h) {
+  std::lock_guard lock(cr_mutex);
+  cairo_surface_t *previous = cairo_surface_create_similar(
+      surface, CAIRO_CONTENT_COLOR, from_w, from_h);
+  cairo_t *copy = cairo_create(previous);
+  cairo_set_source_surface(copy, surface, 0, 0);
+  cairo_paint(copy);
+  cairo_destroy(copy);
 
-  window_width = flat.w;
-  window_height = flat.h;
+  cairo_save(cr);
+  cairo_reset_clip(cr);
+  cairo_scale(cr, static_cast<double>(window_width) / from_w,
+              static_cast<double>(window_height) / from_h);
+  cairo_set_source_surface(cr, previous, 0, 0);
+  cairo_set_operator(cr, CAIRO_OPERATOR_SOURCE);
+  cairo_paint(cr);
+  cairo_restore(cr);
+  cairo_surface_destroy(previous);
 }
@@ -34,13 +34,6 @@ namespace uxdevice {
  */
 typedef std::list<short int> coordinate_list_t;
 
-/** @internal
- * @typedef
- * @brief system domain translator.
- */
-using message_dispatch_t =
-    std::unordered_map<std::size_t, std::function<void()>>;
-
 typedef struct _WH {
   int w = 0;
   int h = 0;
@@ -102,6 +95,7 @@ public:
 
   /// @brief sequence of the video frame flush
   void video_flush(void);
+  void video_flush(const cairo_region_t *damage);
 
   /// @breif resize request from the window, queues them and then only processes
   /// the last one.
@@ -109,8 +103,22 @@ public:
 
   /** @brief function called at a point in time where the render within the
    * context is about to output a frame portion. This gives priorty to the user
-   * resize so that blank areas do not appear on the screen for very long.*/
-  void apply_surface_requests(void);
+   * resize so that blank areas do not appear on the screen for very long.
+   * returns true when a resize has settled and the window needs a repaint.*/
+  bool apply_surface_requests(void);
+
+  /// @brief resize coordination queried by the display context.
+  bool surface_request_waiting(void);
+  bool surface_resizing(void) const noexcept { return surface_settle_pending; }
+  std::optional<std::chrono::steady_clock::time_point>
+  surface_settle_due(void);
+
+  /// @brief requests closer together than this are an interactive resize.
+  std::chrono::milliseconds surface_settle_time =
+      std::chrono::milliseconds(120);
+
+  /// @brief while resizing, the surface grows in these pixel steps.
+  static const int surface_growth_step = 256;
 
   /**
    * @internal
@@ -131,6 +139,8 @@ public:
 
   void set(const painter_brush_t &setting);
 
+  void set(const message_threading_t &setting) { this->threading = setting; }
+
   /**
    * @internal
    * @fn dispatch
@@ -179,11 +189,23 @@ public:
 
 private:
 
-  std::list<_WH> surface_requests_storage = {};
-
-  typedef std::list<_WH>::iterator surface_requests_iter_t;
+  /// @brief only the most recent size is applied.
+  std::optional<_WH> surface_request = {};
   std::mutex surface_requests_storage_mutex = {};
 
+  /// @brief time of the last request and whether a repaint waits for the
+  /// size to settle.
+  std::chrono::steady_clock::time_point surface_request_time = {};
+  std::atomic<bool> surface_settle_pending = false;
+
+  /// @brief allocated size of the surface which may exceed the window.
+  int surface_capacity_width = {};
+  int surface_capacity_height = {};
+
+  void surface_reallocate(const int w, const int h, const int from_w,
+                          const int from_h);
+  void surface_scale(const int from_w, const int from_h);
+
 private:
   /** @internal
    * @brief these variables are common across instances yet they are managed
@@ -76,10 +76,29 @@ class window_manager_interface_t {
   /**
    * @fn fn_resize_surface
    * @brief os implementation of cairo surface resize. xcb version provides a
-   * specific function.
+   * specific function. Surfaces that cannot change size, such as an image
+   * surface, return a new one which the base adopts.
+   * @return cairo_surface_t * - the surface to use after the resize.
    */
-  virtual void fn_resize_surface(cairo_surface_t *surface, const int w,
-                                 const int h) = 0;
+  virtual cairo_surface_t *fn_resize_surface(cairo_surface_t *surface,
+                                             const int w, const int h) = 0;
+
+  /**
+   * @fn fn_present_surface
+   * @brief copies an area of the surface to the window when the surface is
+   * held in client memory. Surfaces drawn directly on the window have
+   * nothing to do.
+   */
+  virtual void fn_present_surface(cairo_surface_t *surface, const int x,
+                                  const int y, const int w, const int h) = 0;
+
+  /**
+   * @fn fn_acquire_surface
+   * @brief called before drawing into the surface. A surface whose memory
+   * the server may still be reading from a prior present waits here until
+   * the server is done. Other surfaces have nothing to do.
+   */
+  virtual void fn_acquire_surface(cairo_surface_t *surface) {}
 
   /**
    * @internal
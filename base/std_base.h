@@ -35,6 +35,8 @@
 #include <atomic>
 #include <bitset>
 #include <cctype>
+#include <charconv>
+#include <chrono>
 #include <climits>
 #include <cmath>
 #include <condition_variable>
@@ -42,9 +44,11 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <deque>
 #include <fstream>
 #include <functional>
 #include <mutex>
+#include <shared_mutex>
 #include <thread>
 
 #include <iomanip>
@@ -53,7 +57,9 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <numeric>
+#include <optional>
 #include <random>
 #include <sstream>
 #include <stdexcept>
@@ -64,6 +70,16 @@
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <variant>
 #include <vector>
+
+#if defined(__linux__)
+#include <errno.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif
@@ -37,16 +37,12 @@ uxdevice::display_context_t::display_context_t(
     : window_manager(_wm) {}
 
 uxdevice::display_context_t::display_context_t(const display_context_t &other)
-    : hash_members_t(other), system_error_t(other), pipeline_memory_t(other),
-      regions_storage(other.regions_storage),
-      surface_requests_storage(other.surface_requests_storage) {}
+    : hash_members_t(other), system_error_t(other), pipeline_memory_t(other) {}
 
 // move constructor
 uxdevice::display_context_t::display_context_t(
     display_context_t &&other) noexcept
-    : hash_members_t(other), system_error_t(other), pipeline_memory_t(other),
-      regions_storage(other.regions_storage),
-      surface_requests_storage(other.surface_requests_storage) {}
+    : hash_members_t(other), system_error_t(other), pipeline_memory_t(other) {}
 
 /**
  * @fn display_context_t operator =&(const display_context_t&)
@@ -61,9 +57,6 @@ uxdevice::display_context_t &uxdevice::display_context_t::operator=(
   system_error_t::operator=(other);
   pipeline_memory_t::operator=(other);
 
-  regions_storage = other.regions_storage;
-  surface_requests_storage = other.surface_requests_storage;
-
   return *this;
 }
 
@@ -71,8 +64,8 @@ uxdevice::display_context_t &uxdevice::display_context_t::operator=(
  * @internal
  * @brief The routine checks the system for render work which primarily arrives
  * to the thread via the regions list. However, when no official work exists,
- * the condition variable cvRenderWork is placed in a wait state. The condition
- * may be awoke by calling the routine state_notify_complete().
+ * the thread waits on render_work_wake. The wait returns at once if
+ * state_notify_complete() was called since the last wait.
  * @return bool - true - work exists, false none.
  */
 bool uxdevice::display_context_t::surface_prime() {
@@ -94,9 +87,11 @@ bool uxdevice::display_context_t::surface_prime() {
   // the state routines could easily produce region rectangular information
   // along the notification but do not. The user should call notify_complete.
   if (!bRet) {
-    std::unique_lock<std::mutex> lk(render_work_mutex);
-    render_work_condition_variable.wait(lk);
-    lk.unlock();
+    auto due = window_manager->surface_settle_due();
+    if (due)
+      render_work_wake.wait_until(*due);
+    else
+      render_work_wake.wait();
     bRet = true;
   }
 
@@ -109,6 +104,15 @@ bool uxdevice::display_context_t::surface_prime() {
  */
 void uxdevice::display_context_t::flush() { window_manager->video_flush(); }
 
+/**
+ * @internal
+ * @overload
+ * @brief only the areas painted within the frame are presented.
+ */
+void uxdevice::display_context_t::flush(const cairo_region_t *damage) {
+  window_manager->video_flush(damage);
+}
+
 /**
  * @internal
  * @brief The routine
@@ -135,10 +139,14 @@ void uxdevice::display_context_t::device_scale(double x, double y) {
  * @brief The routine is called by a client to resize the window surface. In
  * addition, other work may be applied such as paint, however those go into a
  * separate list as the operating system provides these message independently,
- * that is Configure window event and a separate paint rectangle.
+ * that is Configure window event and a separate paint rectangle. The
+ * renderer is woken so it applies the size, and once it knows a resize is
+ * pending it waits with the settle time rather than without a limit, as a
+ * drag that only shrinks the window brings no expose.
  */
 void uxdevice::display_context_t::resize_surface(const int w, const int h) {
   window_manager->resize_surface(w, h);
+  render_work_wake.signal();
 }
 
 /**
@@ -148,35 +156,35 @@ void uxdevice::display_context_t::resize_surface(const int w, const int h) {
  */
 void uxdevice::display_context_t::render(void) {
   clearing_frame = false;
-  bool bEmpty = false;
   context_cairo_region_t processing_region = {};
   cairo_region_t *current = {};
 
+  /// @brief the areas painted within this frame, presented once at the end.
+  cairo_region_t *damage = cairo_region_create();
+
   /**
    * rectangle of area needs painting background first. these are sub areas
    * perhaps multiples exist because of resize coordinate_t. The information
    * is generated from the paint dispatch event. When the window is opened
    * render work will contain entire window */
-  window_manager->apply_surface_requests();
+  apply_surface_requests();
 
   // partitionVisibility();
 
-  // detect any changes that have occurred
-  for (auto n : viewport_on)
-    if (n->has_changed())
-      state(n);
-
-  /// @brief setup while start.
+  /** @brief units changed through the index mark their dependents as they
+   * change. Only the visuals that can change without notice are tested.*/
   {
-    std::lock_guard<std::mutex> lock(regions_storage_mutex);
-    bool bEmpty = regions_storage.empty();
-    if (!bEmpty) {
-      processing_region = regions_storage.front();
-      regions_storage.pop_front();
-    }
+    auto scene = std::atomic_load(&scene_snapshot);
+    if (scene && scene->volatile_visuals)
+      for (auto &w : *scene->volatile_visuals) {
+        auto n = w.lock();
+        if (n && n->has_changed())
+          state(n);
+      }
   }
 
-  while (!bEmpty) {
+  /// @brief os surface regions are taken before object regions.
+  while (region_next(processing_region)) {
 
     /**
      * @brief os surface requests are ideally full screen block coordinate_t
@@ -230,24 +238,12 @@ void uxdevice::display_context_t::render(void) {
       cairo_paint(cr);
     });
 
-    /// @brief flush causes immediate update to video. Perhaps this could be
-    /// adjusted to 60fps. The function has other combinations of mutex locks
-    flush();
+    cairo_region_union_rectangle(damage, &processing_region.rect);
 
     /// @brief process surface requests such as window resizing. Internally
     /// has distinct mutex locks on the surface_mutex, surface_requests_mutex
     /// and cr_mutex.
-    window_manager->apply_surface_requests();
-
-    // iteration to setup next plot area
-    {
-      std::lock_guard lock(regions_storage_mutex);
-      bEmpty = regions_storage.empty();
-      if (!bEmpty) {
-        processing_region = regions_storage.front();
-        regions_storage.pop_front();
-      }
-    }
+    apply_surface_requests();
 
     /// @brief is the frame is being cleared in another thread, just quite
     /// render operation.
@@ -257,6 +253,22 @@ void uxdevice::display_context_t::render(void) {
     }
   }
 
+  /// @brief areas exposed during a resize are presented with this frame.
+  if (surface_expose_waiting) {
+    std::lock_guard lock(surface_expose_mutex);
+    cairo_rectangle_int_t r = {surface_expose_x1, surface_expose_y1,
+                               surface_expose_x2 - surface_expose_x1,
+                               surface_expose_y2 - surface_expose_y1};
+    cairo_region_union_rectangle(damage, &r);
+    surface_expose_waiting = false;
+  }
+
+  /// @brief flush causes update to video of the painted areas only. The
+  /// function has other combinations of mutex locks
+  if (!cairo_region_is_empty(damage))
+    flush(damage);
+  cairo_region_destroy(damage);
+
   if (current)
     cairo_region_destroy(current);
 }
@@ -319,6 +331,32 @@ void uxdevice::display_context_t::add_visual(
   if (!ptr_pipeline->pipeline_has_required_linkages())
     return; // not adding error objects
 
+  add_dependencies(object_ptr, ptr_pipeline.get());
+
+  if (batching) {
+    if (object_ptr->overlap == CAIRO_REGION_OVERLAP_OUT) {
+      batch_off.emplace_back(object_ptr);
+      return;
+    }
+
+    batch_on.emplace_back(object_ptr);
+
+    auto &ink = object_ptr->ink_rectangle;
+    if (batch_region_empty) {
+      batch_x1 = ink.x;
+      batch_y1 = ink.y;
+      batch_x2 = ink.x + ink.width;
+      batch_y2 = ink.y + ink.height;
+      batch_region_empty = false;
+    } else {
+      batch_x1 = std::min(batch_x1, ink.x);
+      batch_y1 = std::min(batch_y1, ink.y);
+      batch_x2 = std::max(batch_x2, ink.x + ink.width);
+      batch_y2 = std::max(batch_y2, ink.y + ink.height);
+    }
+    return;
+  }
+
   if (object_ptr->overlap == CAIRO_REGION_OVERLAP_OUT) {
     std::lock_guard lock(viewport_off_mutex);
     viewport_off.emplace_back(object_ptr);
@@ -326,9 +364,254 @@ void uxdevice::display_context_t::add_visual(
   } else {
     std::lock_guard lock(viewport_on_mutex);
     viewport_on.emplace_back(object_ptr);
-    state(object_ptr);
+
+    /// @brief the area is queued once the visual is in a published scene.
+    scene_regions.emplace_back(region_request_t{
+        object_ptr->ink_rectangle.x, object_ptr->ink_rectangle.y,
+        object_ptr->ink_rectangle.width, object_ptr->ink_rectangle.height,
+        reinterpret_cast<std::size_t>(object_ptr.get()), 0});
+    scene_members_changed = true;
+    scene_staged = true;
+  }
+}
+/**
+ * @internal
+ * @fn add_dependencies
+ * @param std::shared_ptr<display_visual_t> obj
+ * @param pipeline_memory_t *ptr_pipeline
+ * @brief records the visual as a dependent of each unit that was linked to
+ * its pipeline memory during emit. Visuals whose linked data can change
+ * without notification are tested each render.
+ */
+void uxdevice::display_context_t::add_dependencies(
+    std::shared_ptr<display_visual_t> obj, pipeline_memory_t *ptr_pipeline) {
+  {
+    std::lock_guard lock(dependency_storage_mutex);
+    for (auto &n : ptr_pipeline->storage)
+      if (n.second.hash_members)
+        dependency_storage[n.second.hash_members].emplace_back(obj);
+  }
+
+  if (obj->hash_volatile()) {
+    std::lock_guard lock(viewport_volatile_mutex);
+    viewport_volatile.emplace_back(obj);
+    scene_volatile.reset();
+    scene_staged = true;
+  }
+}
+
+/**
+ * @internal
+ * @fn visual_volatile
+ * @param const display_visual_t *obj
+ * @brief the visual is on the list hashed each render.
+ * @return bool
+ */
+bool uxdevice::display_context_t::visual_volatile(
+    const display_visual_t *obj) {
+  std::lock_guard lock(viewport_volatile_mutex);
+  return std::any_of(viewport_volatile.begin(), viewport_volatile.end(),
+                     [&](auto &w) { return w.lock().get() == obj; });
+}
+
+/**
+ * @internal
+ * @fn state_dependents
+ * @param const hash_members_t *unit
+ * @brief marks the visuals that link the unit as changed and adds their area
+ * to the render work. Visuals that no longer exist are removed from the list.
+ * note state_notify_complete must be called after this to inform the renderer
+ * there is work.
+ */
+void uxdevice::display_context_t::state_dependents(
+    const hash_members_t *unit) {
+  std::vector<std::shared_ptr<display_visual_t>> dependents = {};
+
+  {
+    std::lock_guard lock(dependency_storage_mutex);
+    auto item = dependency_storage.find(unit);
+    if (item == dependency_storage.end())
+      return;
+
+    auto &list = item->second;
+    list.erase(std::remove_if(list.begin(), list.end(),
+                              [&](auto &w) {
+                                auto n = w.lock();
+                                if (n)
+                                  dependents.emplace_back(n);
+                                return !n;
+                              }),
+               list.end());
+
+    if (list.empty())
+      dependency_storage.erase(item);
+  }
+
+  for (auto &n : dependents) {
+    n->changed();
+    state(n);
+  }
+}
+
+/**
+ * @internal
+ * @fn batch_begin
+ * @brief visuals added after this call are held until batch_commit. Called
+ * from the client thread.
+ */
+void uxdevice::display_context_t::batch_begin(void) { batching = true; }
+
+/**
+ * @internal
+ * @fn batch_commit
+ * @brief publishes the visuals added since batch_begin with one lock per
+ * viewport list, queues the union of their areas as one region and wakes the
+ * renderer once.
+ */
+void uxdevice::display_context_t::batch_commit(void) {
+  if (!batching)
+    return;
+  batching = false;
+
+  if (!batch_off.empty()) {
+    std::lock_guard lock(viewport_off_mutex);
+    viewport_off.insert(viewport_off.end(),
+                        std::make_move_iterator(batch_off.begin()),
+                        std::make_move_iterator(batch_off.end()));
+  }
+
+  if (!batch_on.empty()) {
+    std::lock_guard lock(viewport_on_mutex);
+    viewport_on.insert(viewport_on.end(),
+                       std::make_move_iterator(batch_on.begin()),
+                       std::make_move_iterator(batch_on.end()));
+
+    if (!batch_region_empty)
+      scene_regions.emplace_back(
+          region_request_t{batch_x1, batch_y1, batch_x2 - batch_x1,
+                           batch_y2 - batch_y1, 0, 0});
+    scene_members_changed = true;
+    scene_staged = true;
+  }
+
+  batch_off.clear();
+  batch_on.clear();
+  batch_region_empty = true;
+
+  state_notify_complete();
+}
+
+/**
+ * @internal
+ * @fn scene_publish
+ * @brief makes the staged visuals visible to the renderer. The staging list
+ * is append only between clears, so the full blocks already sealed are
+ * shared with the prior snapshot. Only new full blocks and the partial last
+ * block are copied. The areas of visuals added since the last publish are
+ * queued after the snapshot is stored so the renderer finds them in it.
+ * Publishers are serialized so snapshots are stored in staging order.
+ */
+void uxdevice::display_context_t::scene_publish(void) {
+  std::lock_guard publish_lock(scene_publish_mutex);
+  if (!scene_staged.exchange(false))
+    return;
+
+  const std::size_t block_size = scene_snapshot_t::block_size;
+  auto next = std::make_shared<scene_snapshot_t>();
+  std::vector<region_request_t> regions = {};
+  bool bmembers = {};
+
+  {
+    std::lock_guard lock(viewport_on_mutex);
+    std::size_t sealed = scene_sealed.size();
+
+    while ((sealed + 1) * block_size <= viewport_on.size()) {
+      auto first = viewport_on.begin() + sealed * block_size;
+      scene_sealed.emplace_back(std::make_shared<const scene_block_t>(
+          first, first + block_size));
+      sealed++;
+    }
+
+    next->blocks = scene_sealed;
+    if (sealed * block_size < viewport_on.size())
+      next->blocks.emplace_back(std::make_shared<const scene_block_t>(
+          viewport_on.begin() + sealed * block_size, viewport_on.end()));
+
+    regions.swap(scene_regions);
+    bmembers = scene_members_changed;
+    scene_members_changed = false;
+  }
+
+  {
+    std::lock_guard lock(viewport_volatile_mutex);
+    if (!scene_volatile)
+      scene_volatile =
+          std::make_shared<const scene_volatile_t>(viewport_volatile);
+    next->volatile_visuals = scene_volatile;
+  }
+
+  std::atomic_store(&scene_snapshot,
+                    std::shared_ptr<const scene_snapshot_t>(next));
+
+  /// @brief a publish for a volatile list change keeps the hit index.
+  if (bmembers)
+    hit_index_stale = true;
+
+  for (auto &r : regions) {
+    r.epoch = regions_epoch;
+    region_push(regions_object_lane, r);
+  }
+}
+
+/**
+ * @internal
+ * @fn hit_test
+ * @param double x
+ * @param double y
+ * @param const hit_refine_t &refine
+ * @brief finds the top most visual whose ink rectangle holds the point. The
+ * refine function, when given, may reject a visual so that the one beneath
+ * is tried.
+ * @return std::shared_ptr<display_visual_t> - empty when nothing is hit.
+ */
+std::shared_ptr<uxdevice::display_visual_t>
+uxdevice::display_context_t::hit_test(double x, double y,
+                                      const hit_refine_t &refine) {
+  std::shared_ptr<const hit_index_t> index = {};
+
+  {
+    std::lock_guard lock(hit_index_mutex);
+    if (hit_index_stale.exchange(false) || !hit_index)
+      hit_index = hit_index_build();
+    index = hit_index;
   }
+
+  return index->query(x, y, refine);
 }
+
+/**
+ * @internal
+ * @fn hit_index_build
+ * @brief indexes the visuals of the published scene that have ink. The
+ * position within the scene is the z order.
+ */
+std::shared_ptr<const uxdevice::hit_index_t>
+uxdevice::display_context_t::hit_index_build(void) {
+  std::vector<hit_index_t::item_t> items = {};
+  auto scene = std::atomic_load(&scene_snapshot);
+  std::size_t z = {};
+
+  if (scene)
+    for (auto &block : scene->blocks)
+      for (auto &n : *block) {
+        if (n->has_ink_extents)
+          items.emplace_back(hit_index_t::item_t{n->ink_rectangle, z, n});
+        z++;
+      }
+
+  return std::make_shared<const hit_index_t>(std::move(items));
+}
+
 /**
  * @internal
  * @brief The routine scans the offscreen list to see if any are now visible.
@@ -343,13 +626,34 @@ void uxdevice::display_context_t::clear(void) {
   clearing_frame = true;
 
   {
-    std::scoped_lock(regions_storage_mutex, viewport_on_mutex,
-                     viewport_off_mutex);
-    regions_storage.remove_if([](auto &n) { return !n.bOSsurface; });
+    std::scoped_lock lock(viewport_on_mutex, viewport_off_mutex);
     viewport_on.clear();
     viewport_off.clear();
+    scene_sealed.clear();
+    scene_regions.clear();
+    scene_members_changed = true;
   }
 
+  batch_on.clear();
+  batch_off.clear();
+  batch_region_empty = true;
+
+  {
+    std::scoped_lock lock(dependency_storage_mutex, viewport_volatile_mutex);
+    dependency_storage.clear();
+    viewport_volatile.clear();
+    scene_volatile.reset();
+  }
+
+  /// @brief the renderer stops drawing the prior scene as soon as it reads
+  /// the empty one.
+  scene_staged = true;
+  scene_publish();
+
+  /** @brief object regions queued before the clear are skipped by the
+   * consumer. os surface regions are kept.*/
+  regions_epoch++;
+
   offsetx = 0;
   offsety = 0;
 
@@ -378,12 +682,12 @@ void uxdevice::display_context_t::surface_brush(painter_brush_t &b) {
  * there is work.
  */
 void uxdevice::display_context_t::state(std::shared_ptr<display_visual_t> obj) {
-  std::lock_guard lock(regions_storage_mutex);
-  std::size_t onum = reinterpret_cast<std::size_t>(obj.get());
-
-  regions_storage.emplace_back(context_cairo_region_t(
-      onum, obj->ink_rectangle.x, obj->ink_rectangle.y,
-      obj->ink_rectangle.width, obj->ink_rectangle.height));
+  region_push(regions_object_lane,
+              region_request_t{obj->ink_rectangle.x, obj->ink_rectangle.y,
+                               obj->ink_rectangle.width,
+                               obj->ink_rectangle.height,
+                               reinterpret_cast<std::size_t>(obj.get()),
+                               regions_epoch});
 }
 
 /**
@@ -393,34 +697,145 @@ void uxdevice::display_context_t::state(std::shared_ptr<display_visual_t> obj) {
  * renderer there is work.
  */
 void uxdevice::display_context_t::state(int x, int y, int w, int h) {
-  std::lock_guard lock(regions_storage_mutex);
-  regions_storage.emplace_back(context_cairo_region_t{false, x, y, w, h});
+  region_push(regions_object_lane,
+              region_request_t{x, y, w, h, 0, regions_epoch});
 }
 
 /**
  * @internal
  * @brief The routine adds a surface oriented painting request to the render
- * queue. the items are inserted first before any other so that painting of
- * a newly resized window area occurs first.
+ * queue. the items are placed in a separate lane which the renderer takes
+ * before any other so that painting of a newly resized window area occurs
+ * first. The renderer is woken for it.
  */
 void uxdevice::display_context_t::state_surface(int x, int y, int w, int h) {
-  std::lock_guard lock(regions_storage_mutex);
-  auto it = std::find_if(regions_storage.begin(), regions_storage.end(),
-                         [](auto &n) { return !n.bOSsurface; });
-  if (it != regions_storage.end())
-    regions_storage.insert(it, context_cairo_region_t{true, x, y, w, h});
-  else
-    regions_storage.emplace_back(context_cairo_region_t{true, x, y, w, h});
+  /// @brief during an interactive resize the scaled previous frame is shown
+  /// and one full repaint is queued when the size settles. The exposed area
+  /// is presented with the next frame of the render thread.
+  if (window_manager->surface_resizing()) {
+    surface_expose(x, y, w, h);
+    render_work_wake.signal();
+    return;
+  }
+
+  region_push(regions_surface_lane,
+              region_request_t{x, y, w, h, 0, regions_epoch});
+
+  /// @brief an os paint request is work of its own. An idle renderer, or
+  /// the reactor with no frame armed, would otherwise not see it until the
+  /// client notifies.
+  render_work_wake.signal();
+}
+
+/**
+ * @internal
+ * @fn surface_expose
+ * @brief adds an area to the bounds presented with the next frame.
+ */
+void uxdevice::display_context_t::surface_expose(int x, int y, int w, int h) {
+  std::lock_guard lock(surface_expose_mutex);
+  if (!surface_expose_waiting) {
+    surface_expose_x1 = x;
+    surface_expose_y1 = y;
+    surface_expose_x2 = x + w;
+    surface_expose_y2 = y + h;
+  } else {
+    surface_expose_x1 = std::min(surface_expose_x1, x);
+    surface_expose_y1 = std::min(surface_expose_y1, y);
+    surface_expose_x2 = std::max(surface_expose_x2, x + w);
+    surface_expose_y2 = std::max(surface_expose_y2, y + h);
+  }
+  surface_expose_waiting = true;
+}
+
+/**
+ * @internal
+ * @fn apply_surface_requests
+ * @brief sizes the surface from the window requests. When an interactive
+ * resize settles, the whole window is queued for one repaint. A size applied
+ * during the drag presents the scaled frame with the next flush.
+ */
+void uxdevice::display_context_t::apply_surface_requests(void) {
+  int w = window_manager->window_width;
+  int h = window_manager->window_height;
+
+  if (window_manager->apply_surface_requests()) {
+    region_push(regions_surface_lane,
+                region_request_t{0, 0, window_manager->window_width,
+                                 window_manager->window_height, 0,
+                                 regions_epoch});
+
+    /// @brief the frame was scaled to a new size during the drag.
+  } else if (w != window_manager->window_width ||
+             h != window_manager->window_height) {
+    surface_expose(0, 0, window_manager->window_width,
+                   window_manager->window_height);
+  }
 }
+
+/**
+ * @internal
+ * @fn region_push
+ * @brief adds the request to a lane. When the lane is full, the request is
+ * replaced by a repaint of the whole surface which the renderer produces once
+ * it notices the overflow.
+ */
+template <typename T>
+void uxdevice::display_context_t::region_push(T &lane,
+                                              const region_request_t &r) {
+  if (!lane.push(r))
+    regions_overflow = true;
+}
+
+/**
+ * @internal
+ * @fn region_next
+ * @param context_cairo_region_t &r
+ * @brief consumer side of the region lanes, called by render. Object regions
+ * queued before the last clear() are discarded.
+ * @return bool - false when no work remains.
+ */
+bool uxdevice::display_context_t::region_next(context_cairo_region_t &r) {
+  region_request_t request = {};
+
+  if (regions_overflow.exchange(false)) {
+    r = context_cairo_region_t{true, 0, 0, window_manager->window_width,
+                               window_manager->window_height};
+    return true;
+  }
+
+  if (regions_surface_lane.pop(request)) {
+    r = context_cairo_region_t{true, request.x, request.y, request.w,
+                               request.h};
+    return true;
+  }
+
+  while (regions_object_lane.pop(request)) {
+    if (request.epoch != regions_epoch)
+      continue;
+
+    if (request.obj)
+      r = context_cairo_region_t{request.obj, request.x, request.y, request.w,
+                                 request.h};
+    else
+      r = context_cairo_region_t{false, request.x, request.y, request.w,
+                                 request.h};
+    return true;
+  }
+
+  return false;
+}
+
 /**
  * @internal
- * @brief The routine notifies the condition variable that work has been
+ * @brief The routine signals the render thread that work has been
  * requested and should immediately being to render. Having this as a
  * separate function provides the ability to add work without rendering
  * occurring. However, message queue calls this when a resize occurs.
  */
 void uxdevice::display_context_t::state_notify_complete(void) {
-  render_work_condition_variable.notify_one();
+  scene_publish();
+  render_work_wake.signal();
 }
 
 /**
@@ -430,19 +845,14 @@ void uxdevice::display_context_t::state_notify_complete(void) {
 bool uxdevice::display_context_t::state(void) {
   bool ret = {};
 
-  {
-    std::lock_guard lock(regions_storage_mutex);
-    ret = !regions_storage.empty();
-  }
+  ret = regions_overflow || !regions_surface_lane.empty() ||
+        !regions_object_lane.empty();
 
   /** surface requests should be performed, the render function sets the
-   * surface size and exits if no region work.*/
-  if (!ret) {
-    {
-      std::lock_guard lock(surface_requests_storage_mutex);
-      ret = !surface_requests_storage.empty();
-    }
-  }
+   * surface size and exits if no region work. A resize waiting to settle is
+   * not work, surface_prime wakes for it when it is due.*/
+  if (!ret)
+    ret = window_manager->surface_request_waiting() || surface_expose_waiting;
 
   return ret;
 }
@@ -455,54 +865,45 @@ bool uxdevice::display_context_t::state(void) {
  * rectangle is within the region.
  */
 void uxdevice::display_context_t::plot(context_cairo_region_t &plotArea) {
-  bool bDone = false;
-
-  /// @brief exit early if empty.
-  {
-    std::lock_guard<std::mutex> lock(viewport_on_mutex);
-    if (viewport_on.empty())
-      return;
-  }
-  /// @brief iterator used for sequence of viewport_on
-  display_visual_list_t::iterator itUnit = {};
-  /// @brief iterator to item.
-  std::shared_ptr<display_visual_t> n = {};
-  {
-    std::lock_guard lock(viewport_on_mutex);
-    itUnit = viewport_on.begin();
-    n = *itUnit;
-  }
-
-  while (!bDone) {
-
-    n->intersect(plotArea._rect);
-
-    switch (n->overlap) {
-    case CAIRO_REGION_OVERLAP_OUT:
-      break;
-    case CAIRO_REGION_OVERLAP_IN: {
-      n->fn_draw();
-    } break;
-    case CAIRO_REGION_OVERLAP_PART: {
-      n->fn_draw_clipped();
-    } break;
-    }
-
-    /// @brief save the state as being rendered.
-    n->state_hash_code();
+  /// @brief the list of the published scene does not change, no lock is
+  /// held while walking it. The intersection and used hash written to each
+  /// visual here belong to the render thread.
+  auto scene = std::atomic_load(&scene_snapshot);
+  if (!scene)
+    return;
+
+  for (auto &block : scene->blocks)
+    for (auto &n : *block) {
+      n->intersect(plotArea._rect);
+
+      switch (n->overlap) {
+      case CAIRO_REGION_OVERLAP_OUT:
+        break;
+      case CAIRO_REGION_OVERLAP_IN: {
+        n->fn_draw();
+      } break;
+      case CAIRO_REGION_OVERLAP_PART: {
+        n->fn_draw_clipped();
+      } break;
+      }
 
-    if (clearing_frame) {
-      bDone = true;
-      continue;
-    }
+      /// @brief save the state as being rendered.
+      n->state_hash_code();
+
+      /// @brief the ink is measured while drawing. Only a visual whose ink
+      /// moved or changed size makes the hit index stale.
+      auto &ink = n->ink_rectangle;
+      auto &indexed = n->hit_ink_rectangle;
+      if (ink.x != indexed.x || ink.y != indexed.y ||
+          ink.width != indexed.width || ink.height != indexed.height) {
+        indexed = ink;
+        hit_index_stale = true;
+      }
 
-    /// @TODO iterator might be bad if list is cleared.
-    {
-      std::lock_guard lock(viewport_on_mutex);
-      itUnit++;
-      bDone = itUnit == viewport_on.end();
+      /// @brief a newer scene replaces this one.
+      if (clearing_frame)
+        return;
     }
-  }
 }
 
 bool uxdevice::display_context_t::pipeline_has_required_linkages(void) {
@@ -55,6 +55,8 @@ class display_context_t : virtual public hash_members_t,
                           virtual system_error_t,
                           public pipeline_memory_t {
 public:
+  class region_request_t;
+
   display_context_t(void) {}
   display_context_t(std::shared_ptr<os_window_manager> _wm);
 
@@ -68,6 +70,7 @@ public:
   bool surface_prime(void);
   void plot(context_cairo_region_t &plotArea);
   void flush(void);
+  void flush(const cairo_region_t *damage);
   void device_offset(double x, double y);
   void device_scale(double x, double y);
 
@@ -83,13 +86,32 @@ public:
   void state(int x, int y, int w, int h);
   bool state(void);
   void state_surface(int x, int y, int w, int h);
+  void apply_surface_requests(void);
   void state_notify_complete(void);
+  void state_dependents(const hash_members_t *unit);
+  bool visual_volatile(const display_visual_t *obj);
+
+  void batch_begin(void);
+  void batch_commit(void);
+  void scene_publish(void);
+
+  std::shared_ptr<display_visual_t> hit_test(double x, double y,
+                                             const hit_refine_t &refine = {});
 
   void clear(void);
   virtual void pipeline_acquire(){};
   virtual bool pipeline_has_required_linkages(void);
   virtual std::size_t hash_code(void) const noexcept;
 
+private:
+  template <typename T>
+  void region_push(T &lane, const region_request_t &r);
+  bool region_next(context_cairo_region_t &r);
+
+  std::shared_ptr<const hit_index_t> hit_index_build(void);
+
+  void add_dependencies(std::shared_ptr<display_visual_t> obj,
+                        pipeline_memory_t *ptr_pipeline);
 
 public:
   std::shared_ptr<os_window_manager> window_manager = {};
@@ -108,22 +130,103 @@ public:
   display_visual_list_t viewport_on = {};
   std::mutex viewport_on_mutex = {};
 
-  std::mutex regions_storage_mutex = {};
-  std::list<context_cairo_region_t> regions_storage = {};
-  typedef std::list<context_cairo_region_t>::iterator region_iter_t;
-
-  std::mutex render_work_mutex = {};
-  std::condition_variable render_work_condition_variable = {};
-
-  typedef struct _WH {
-    int w = 0;
-    int h = 0;
-    _WH(int _w, int _h) : w(_w), h(_h) {}
-  } __WH;
-  std::list<_WH> surface_requests_storage = {};
-
-  typedef std::list<_WH>::iterator surface_requests_iter_t;
-  std::mutex surface_requests_storage_mutex = {};
+  /// @brief reverse index from a linked unit to the visuals that link it.
+  /// Built as visuals are added so that a change to a shared attribute marks
+  /// only its dependents.
+  typedef std::vector<std::weak_ptr<display_visual_t>> dependent_list_t;
+  std::unordered_map<const hash_members_t *, dependent_list_t>
+      dependency_storage = {};
+  std::mutex dependency_storage_mutex = {};
+
+  /// @brief visuals that must be hashed to detect a change. Others are marked
+  /// through the dependency index.
+  std::vector<std::weak_ptr<display_visual_t>> viewport_volatile = {};
+  std::mutex viewport_volatile_mutex = {};
+
+  /// @brief the list of visuals published for the renderer. The list is not
+  /// changed once published, the visuals in it are. The client stages into
+  /// viewport_on and publishes by swapping the snapshot pointer with
+  /// std::atomic_store. Full blocks are shared between successive snapshots.
+  /// The overlap, intersection, used hash and hit ink rectangle of a listed
+  /// visual are per frame render state written by plot() on the render
+  /// thread only.
+  typedef std::vector<std::shared_ptr<display_visual_t>> scene_block_t;
+  typedef std::vector<std::weak_ptr<display_visual_t>> scene_volatile_t;
+  class scene_snapshot_t {
+  public:
+    static constexpr std::size_t block_size = 256;
+    std::vector<std::shared_ptr<const scene_block_t>> blocks = {};
+    std::shared_ptr<const scene_volatile_t> volatile_visuals = {};
+  };
+  /// @brief read and written only through std::atomic_load and
+  /// std::atomic_store. Those shared_ptr overloads are deprecated in C++20,
+  /// where the member becomes std::atomic<std::shared_ptr<...>>.
+  std::shared_ptr<const scene_snapshot_t> scene_snapshot = {};
+  std::atomic<bool> scene_staged = false;
+
+  /// @brief held for the whole of scene_publish. The client, the render
+  /// thread and number fn_changed callbacks from any thread publish, and a
+  /// slower publisher must not store its snapshot over a newer one.
+  std::mutex scene_publish_mutex = {};
+
+  /// @brief staging side of the snapshot. scene_sealed, scene_regions and
+  /// scene_members_changed are guarded by viewport_on_mutex, scene_volatile
+  /// by viewport_volatile_mutex. scene_members_changed notes that visuals
+  /// were added or removed, which makes the hit index stale at publish.
+  std::vector<std::shared_ptr<const scene_block_t>> scene_sealed = {};
+  bool scene_members_changed = false;
+  std::shared_ptr<const scene_volatile_t> scene_volatile = {};
+
+  /// @brief visuals added between batch_begin and batch_commit. These are
+  /// used by the client thread only and are published to the viewport lists
+  /// at commit with one merged paint region.
+  bool batching = false;
+  display_visual_list_t batch_on = {};
+  display_visual_list_t batch_off = {};
+  bool batch_region_empty = true;
+  int batch_x1 = {}, batch_y1 = {}, batch_x2 = {}, batch_y2 = {};
+
+  /// @brief a region paint request as queued by the producers. The renderer
+  /// forms the context_cairo_region_t.
+  class region_request_t {
+  public:
+    int x = {};
+    int y = {};
+    int w = {};
+    int h = {};
+    std::size_t obj = {};
+    std::size_t epoch = {};
+  };
+
+  /// @brief os surface regions and object regions are separate lanes so that
+  /// the surface regions are painted first without searching.
+  mpsc_ring_t<region_request_t, 256> regions_surface_lane = {};
+  mpsc_ring_t<region_request_t, 4096> regions_object_lane = {};
+  std::atomic<bool> regions_overflow = false;
+  std::atomic<std::size_t> regions_epoch = {};
+
+  /// @brief areas of visuals staged since the last publish.
+  std::vector<region_request_t> scene_regions = {};
+
+  /// @brief areas the os exposed, and the scaled frame, during an
+  /// interactive resize. The render thread adds them to the damage it
+  /// presents next. The bounds are guarded by surface_expose_mutex.
+  std::mutex surface_expose_mutex = {};
+  std::atomic<bool> surface_expose_waiting = false;
+  int surface_expose_x1 = {}, surface_expose_y1 = {};
+  int surface_expose_x2 = {}, surface_expose_y2 = {};
+  void surface_expose(int x, int y, int w, int h);
+
+  /// @brief pointer hit index of the published scene. It is rebuilt by the
+  /// first hit test after visuals are added or removed or the ink rectangle
+  /// of one changes. A repaint that keeps the ink keeps the index.
+  std::shared_ptr<const hit_index_t> hit_index = {};
+  std::atomic<bool> hit_index_stale = true;
+  std::mutex hit_index_mutex = {};
+
+  /// @brief wakes the render thread. The regions are the work, this only
+  /// counts that some was added.
+  wake_event_t render_work_wake = {};
 };
 
 } // namespace uxdevice
@@ -0,0 +1,98 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @author Anthony Matarazzo
+ * @file font_description_intern.cpp
+ * @date 10/18/26
+ * @version 1.0
+ * @brief process wide table of parsed font descriptions.
+ */
+// clang-format off
+
+#include <base/unit_object.h>
+#include "font_description_intern.h"
+
+// clang-format on
+
+/**
+ * @internal
+ * @fn instance
+ * @brief the process wide table.
+ */
+uxdevice::font_description_intern_t &
+uxdevice::font_description_intern_t::instance(void) {
+  static font_description_intern_t table;
+  return table;
+}
+
+uxdevice::font_description_intern_t::~font_description_intern_t() {
+  for (auto &n : canonical_storage)
+    pango_font_description_free(n.second);
+}
+
+/**
+ * @internal
+ * @fn intern
+ * @param const std::string &description
+ * @brief returns the shared font description for the string. The common case,
+ * a string that has been seen before, takes only the shared lock. When the
+ * string is new, it is parsed and the canonical form produced by pango is used
+ * to find an existing equivalent description.
+ * @return const PangoFontDescription * - nullptr if the string cannot be
+ * parsed.
+ */
+const PangoFontDescription *
+uxdevice::font_description_intern_t::intern(const std::string &description) {
+  {
+    std::shared_lock lock(intern_mutex);
+    auto it = storage.find(description);
+    if (it != storage.end())
+      return it->second;
+  }
+
+  PangoFontDescription *font = pango_font_description_from_string(
+      description.data());
+  if (!font)
+    return nullptr;
+
+  char *canonical_cstr = pango_font_description_to_string(font);
+  std::string canonical = canonical_cstr;
+  g_free(canonical_cstr);
+
+  std::unique_lock lock(intern_mutex);
+
+  /** @brief another thread may have interned the same description or an
+   * equivalent one while the lock was not held.*/
+  auto it = storage.find(description);
+  if (it != storage.end()) {
+    pango_font_description_free(font);
+    return it->second;
+  }
+
+  auto canonical_it = canonical_storage.find(canonical);
+  if (canonical_it != canonical_storage.end()) {
+    pango_font_description_free(font);
+    font = canonical_it->second;
+  } else {
+    canonical_storage[canonical] = font;
+  }
+
+  storage[description] = font;
+  return font;
+}
@@ -0,0 +1,58 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @author Anthony Matarazzo
+ * @file font_description_intern.h
+ * @date 10/18/26
+ * @version 1.0
+ * @brief process wide table of parsed font descriptions.
+ * @details Each unique font description string is parsed once. The resulting
+ * PangoFontDescription is immutable and shared by every text_font_t that names
+ * it. Descriptions that are spelled differently but parse to the same font,
+ * such as "Arial 20px" and "arial 20px", resolve to the same pointer so that
+ * comparisons are pointer equality.
+ */
+
+#pragma once
+
+namespace uxdevice {
+
+/**
+ * @internal
+ * @class font_description_intern_t
+ * @brief the intern table. Pointers returned are valid for the life of the
+ * process and must not be freed or modified by the caller.
+ */
+class font_description_intern_t {
+public:
+  static font_description_intern_t &instance(void);
+
+  const PangoFontDescription *intern(const std::string &description);
+
+private:
+  font_description_intern_t() {}
+  ~font_description_intern_t();
+
+  std::shared_mutex intern_mutex = {};
+  std::unordered_map<std::string, PangoFontDescription *> storage = {};
+  std::unordered_map<std::string, PangoFontDescription *> canonical_storage =
+      {};
+};
+
+} // namespace uxdevice
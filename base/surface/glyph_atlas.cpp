@@ -0,0 +1,265 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @author Anthony Matarazzo
+ * @file glyph_atlas.cpp
+ * @date 10/18/26
+ * @version 1.0
+ * @brief packed A8 image surfaces holding rasterized glyph masks.
+ */
+// clang-format off
+
+#include <base/unit_object.h>
+#include "glyph_atlas.h"
+
+// clang-format on
+
+/**
+ * @internal
+ * @fn instance
+ * @brief the process wide atlas.
+ */
+uxdevice::glyph_atlas_t &uxdevice::glyph_atlas_t::instance(void) {
+  static glyph_atlas_t atlas;
+  return atlas;
+}
+
+uxdevice::glyph_atlas_t::~glyph_atlas_t() { clear(); }
+
+/**
+ * @internal
+ * @fn show_layout
+ * @param cairo_t *cr
+ * @param PangoLayout *layout
+ * @brief draws the glyphs of the layout at the current point by masking the
+ * source with atlas slots. Only the glyphs are drawn, decorations such as
+ * underline are available through text_render_normal_t.
+ */
+void uxdevice::glyph_atlas_t::show_layout(cairo_t *cr, PangoLayout *layout) {
+  cairo_matrix_t matrix = {};
+  cairo_get_matrix(cr, &matrix);
+
+  if (matrix.xx != 1.0 || matrix.yy != 1.0 || matrix.xy != 0.0 ||
+      matrix.yx != 0.0) {
+    pango_cairo_show_layout(cr, layout);
+    return;
+  }
+
+  double origin_x = {}, origin_y = {};
+  if (cairo_has_current_point(cr))
+    cairo_get_current_point(cr, &origin_x, &origin_y);
+
+  /** @brief glyph positions are quantized in device space.*/
+  origin_x += matrix.x0;
+  origin_y += matrix.y0;
+
+  std::lock_guard lock(atlas_mutex);
+
+  /** @brief the pages filled during the prior layout are emptied before any
+   * glyph of this one is placed.*/
+  if (clear_pending) {
+    clear();
+    clear_pending = false;
+  }
+
+  PangoLayoutIter *iter = pango_layout_get_iter(layout);
+  do {
+    PangoLayoutRun *run = pango_layout_iter_get_run_readonly(iter);
+    if (!run)
+      continue;
+
+    glyph_atlas_key_t key = {};
+    key.font = pango_cairo_font_get_scaled_font(
+        PANGO_CAIRO_FONT(run->item->analysis.font));
+    if (!key.font)
+      continue;
+
+    PangoRectangle logical_rect = {};
+    pango_layout_iter_get_run_extents(iter, nullptr, &logical_rect);
+    double baseline =
+        origin_y + (double)pango_layout_iter_get_baseline(iter) / PANGO_SCALE;
+    int x_units = logical_rect.x;
+
+    for (int i = 0; i < run->glyphs->num_glyphs; i++) {
+      const PangoGlyphInfo &info = run->glyphs->glyphs[i];
+      double gx = origin_x +
+                  (double)(x_units + info.geometry.x_offset) / PANGO_SCALE;
+      double gy = baseline + (double)info.geometry.y_offset / PANGO_SCALE;
+      x_units += info.geometry.width;
+
+      if (info.glyph == PANGO_GLYPH_EMPTY ||
+          (info.glyph & PANGO_GLYPH_UNKNOWN_FLAG))
+        continue;
+
+      double ix = std::floor(gx);
+      key.glyph = info.glyph;
+      key.subpixel = std::min(static_cast<int>((gx - ix) * subpixel_steps),
+                              subpixel_steps - 1);
+
+      const glyph_atlas_slot_t *s = slot(key);
+
+      /** @brief the glyph could not be placed, it is drawn by cairo.*/
+      if (!s || s->oversize) {
+        cairo_glyph_t glyph = {info.glyph, gx - matrix.x0, gy - matrix.y0};
+        cairo_save(cr);
+        cairo_set_scaled_font(cr, key.font);
+        cairo_show_glyphs(cr, &glyph, 1);
+        cairo_restore(cr);
+        continue;
+      }
+
+      if (!s->surface)
+        continue;
+
+      cairo_mask_surface(cr, s->surface, ix + s->x_offset - matrix.x0,
+                         std::round(gy) + s->y_offset - matrix.y0);
+    }
+  } while (pango_layout_iter_next_run(iter));
+
+  pango_layout_iter_free(iter);
+}
+
+/**
+ * @internal
+ * @fn slot
+ * @param const glyph_atlas_key_t &key
+ * @brief finds or rasterizes the glyph. The caller holds the atlas_mutex.
+ * @return const glyph_atlas_slot_t * - null when the atlas is full.
+ */
+const uxdevice::glyph_atlas_slot_t *
+uxdevice::glyph_atlas_t::slot(const glyph_atlas_key_t &key) {
+  auto it = storage.find(key);
+  if (it != storage.end()) {
+    hits++;
+    return &it->second;
+  }
+
+  misses++;
+
+  cairo_glyph_t glyph = {key.glyph, (double)key.subpixel / subpixel_steps,
+                         0.0};
+  cairo_text_extents_t extents = {};
+  cairo_scaled_font_glyph_extents(key.font, &glyph, 1, &extents);
+
+  glyph_atlas_slot_t _slot = {};
+
+  /** @brief one pixel of padding is left on each side for antialiasing.*/
+  int width = static_cast<int>(std::ceil(extents.width)) + 2;
+  int height = static_cast<int>(std::ceil(extents.height)) + 2;
+
+  bool inked = extents.width > 0 && extents.height > 0;
+
+  if (inked && (width > page_size || height > page_size)) {
+    _slot.oversize = true;
+
+  } else if (inked) {
+    if (!allocate(width, height, _slot))
+      return nullptr;
+
+    _slot.x_offset =
+        static_cast<int>(std::floor(glyph.x + extents.x_bearing)) - 1;
+    _slot.y_offset = static_cast<int>(std::floor(extents.y_bearing)) - 1;
+
+    cairo_t *glyph_cr = cairo_create(_slot.surface);
+    cairo_set_scaled_font(glyph_cr, key.font);
+    glyph.x -= _slot.x_offset;
+    glyph.y -= _slot.y_offset;
+    cairo_show_glyphs(glyph_cr, &glyph, 1);
+    cairo_destroy(glyph_cr);
+  }
+
+  if (font_references.insert(key.font).second)
+    cairo_scaled_font_reference(key.font);
+
+  return &storage.emplace(key, _slot).first->second;
+}
+
+/**
+ * @internal
+ * @fn allocate
+ * @param int width
+ * @param int height
+ * @param glyph_atlas_slot_t &_slot
+ * @brief places a rectangle on the last page. A new page is added when it does
+ * not fit. At the page limit nothing is placed and the atlas is emptied at the
+ * start of the next layout, so the slots in use by the current one remain.
+ * @return bool - true if the slot surface was created.
+ */
+bool uxdevice::glyph_atlas_t::allocate(int width, int height,
+                                       glyph_atlas_slot_t &_slot) {
+  if (clear_pending)
+    return false;
+
+  auto fits = [&](glyph_atlas_page_t &page) {
+    if (page.shelf_x + width > page_size) {
+      page.shelf_y += page.shelf_height;
+      page.shelf_x = 0;
+      page.shelf_height = 0;
+    }
+    return page.shelf_y + height <= page_size;
+  };
+
+  if (pages.empty() || !fits(pages.back())) {
+    if (pages.size() == static_cast<std::size_t>(page_limit)) {
+      clear_pending = true;
+      return false;
+    }
+
+    glyph_atlas_page_t page = {};
+    page.surface =
+        cairo_image_surface_create(CAIRO_FORMAT_A8, page_size, page_size);
+    if (cairo_surface_status(page.surface) != CAIRO_STATUS_SUCCESS) {
+      error_report(__FILE__, __LINE__, __func__,
+                   "glyph atlas page could not be created.");
+      cairo_surface_destroy(page.surface);
+      return false;
+    }
+    pages.emplace_back(page);
+  }
+
+  glyph_atlas_page_t &page = pages.back();
+  _slot.surface = cairo_surface_create_for_rectangle(
+      page.surface, page.shelf_x, page.shelf_y, width, height);
+  page.shelf_x += width;
+  page.shelf_height = std::max(page.shelf_height, height);
+
+  return true;
+}
+
+/**
+ * @internal
+ * @fn clear
+ * @brief releases the pages, slots and font references. Called from
+ * show_layout with the atlas_mutex held, before any glyph is placed, or at
+ * exit.
+ */
+void uxdevice::glyph_atlas_t::clear(void) {
+  for (auto &n : storage)
+    if (n.second.surface)
+      cairo_surface_destroy(n.second.surface);
+  storage.clear();
+
+  for (auto &page : pages)
+    cairo_surface_destroy(page.surface);
+  pages.clear();
+
+  for (auto font : font_references)
+    cairo_scaled_font_destroy(font);
+  font_references.clear();
+}
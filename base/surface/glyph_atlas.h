@@ -0,0 +1,137 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @author Anthony Matarazzo
+ * @file glyph_atlas.h
+ * @date 10/18/26
+ * @version 1.0
+ * @brief packed A8 image surfaces holding rasterized glyph masks.
+ * @details The atlas is used by text_render_atlas_t. Glyphs are rasterized
+ * once per scaled font, glyph index and horizontal subpixel offset into a
+ * shelf packed page. Text is drawn by masking the current cairo source with
+ * the glyph slot, so the color and brush units apply as they do for
+ * pango_cairo_show_layout.
+ */
+
+#pragma once
+
+namespace uxdevice {
+
+/**
+ * @internal
+ * @class glyph_atlas_key_t
+ * @brief the scaled font carries the face, size, matrix and font options. The
+ * subpixel member is the quantized horizontal offset of the glyph origin
+ * within a device pixel.
+ */
+class glyph_atlas_key_t {
+public:
+  bool operator==(const glyph_atlas_key_t &other) const noexcept {
+    return font == other.font && glyph == other.glyph &&
+           subpixel == other.subpixel;
+  }
+
+  std::size_t hash_code(void) const noexcept {
+    std::size_t __value = {};
+    hash_combine(__value, font, glyph, subpixel);
+    return __value;
+  }
+
+  cairo_scaled_font_t *font = {};
+  unsigned long glyph = {};
+  int subpixel = {};
+};
+
+} // namespace uxdevice
+
+UX_REGISTER_STD_HASH_SPECIALIZATION(uxdevice::glyph_atlas_key_t)
+
+namespace uxdevice {
+
+/**
+ * @internal
+ * @class glyph_atlas_slot_t
+ * @brief a sub surface of a page holding one glyph mask. The offsets position
+ * the mask relative to the integer pixel of the glyph origin. Glyphs having no
+ * ink, such as spaces, have a null surface.
+ */
+class glyph_atlas_slot_t {
+public:
+  cairo_surface_t *surface = {};
+  int x_offset = {};
+  int y_offset = {};
+
+  /// @brief the glyph is larger than a page and is drawn by cairo.
+  bool oversize = false;
+};
+
+/**
+ * @internal
+ * @class glyph_atlas_page_t
+ * @brief an A8 image surface packed with horizontal shelves. Glyphs are placed
+ * left to right on the last shelf. A new shelf is opened beneath when the
+ * glyph does not fit.
+ */
+class glyph_atlas_page_t {
+public:
+  cairo_surface_t *surface = {};
+  int shelf_y = {};
+  int shelf_x = {};
+  int shelf_height = {};
+};
+
+/**
+ * @internal
+ * @class glyph_atlas_t
+ * @brief the process wide atlas. When all pages are full, the glyphs not yet
+ * placed are drawn by cairo for the rest of the layout and the atlas is
+ * emptied before the next one. Drawing falls back to pango when the cairo
+ * matrix is not a translation, as masks are rasterized in device space.
+ */
+class glyph_atlas_t : public system_error_t {
+public:
+  static glyph_atlas_t &instance(void);
+
+  void show_layout(cairo_t *cr, PangoLayout *layout);
+
+  static const int page_size = 1024;
+  static const int page_limit = 8;
+  static const int subpixel_steps = 4;
+
+  std::atomic<std::size_t> hits = {};
+  std::atomic<std::size_t> misses = {};
+
+private:
+  glyph_atlas_t() {}
+  ~glyph_atlas_t();
+
+  const glyph_atlas_slot_t *slot(const glyph_atlas_key_t &key);
+  bool allocate(int width, int height, glyph_atlas_slot_t &_slot);
+  void clear(void);
+
+  /// @brief set when the page limit is reached within a layout.
+  bool clear_pending = false;
+
+  std::mutex atlas_mutex = {};
+  std::unordered_map<glyph_atlas_key_t, glyph_atlas_slot_t> storage = {};
+  std::vector<glyph_atlas_page_t> pages = {};
+  std::unordered_set<cairo_scaled_font_t *> font_references = {};
+};
+
+} // namespace uxdevice
@@ -0,0 +1,107 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @author Anthony Matarazzo
+ * @file glyph_atlas_bench.cpp
+ * @date 10/18/26
+ * @version 1.0
+ * @brief throughput of text_render_atlas_t drawing against
+ * pango_cairo_show_layout for a screen of small labels.
+ * @details standalone program, not part of the library. Build it with the
+ * library sources, for example
+ *
+ *   g++ -std=c++17 -O2 -I. base/surface/glyph_atlas_bench.cpp <library
+ *   objects> $(pkg-config --cflags --libs pangocairo xcb xcb-shm
+ *   xcb-keysyms x11-xcb librsvg-2.0)
+ *
+ * and run as glyph_atlas_bench [frames]. Each frame draws the labels of a
+ * 1920x1080 ARGB32 image surface. The shaped layouts are made once so that
+ * only glyph drawing is measured.
+ */
+// clang-format off
+
+#include <base/unit_object.h>
+
+// clang-format on
+
+int main(int argc, char **argv) {
+  using namespace uxdevice;
+
+  const int frames = argc > 1 ? std::max(std::atoi(argv[1]), 1) : 200;
+  const int columns = 10, rows = 50;
+  const std::array<const char *, 8> labels = {
+      "Label 0123456789",   "status: ready",   "Temperature 21.5 C",
+      "Queue depth 128",    "Throughput 4 MB", "Errors 0 / 10000",
+      "Connected 10.0.0.1", "Uptime 12:45:09"};
+
+  cairo_surface_t *surface =
+      cairo_image_surface_create(CAIRO_FORMAT_ARGB32, 1920, 1080);
+  cairo_t *cr = cairo_create(surface);
+  PangoFontDescription *description =
+      pango_font_description_from_string("Sans 11");
+
+  std::vector<PangoLayout *> layouts = {};
+  for (auto text : labels) {
+    PangoLayout *layout = pango_cairo_create_layout(cr);
+    pango_layout_set_font_description(layout, description);
+    pango_layout_set_text(layout, text, -1);
+    pango_layout_get_pixel_extents(layout, nullptr, nullptr);
+    layouts.emplace_back(layout);
+  }
+
+  auto measure = [&](const char *name, auto draw) {
+    cairo_set_source_rgb(cr, 0, 0, 0);
+    auto start = std::chrono::steady_clock::now();
+
+    for (int f = 0; f < frames; f++)
+      for (int i = 0; i < columns * rows; i++) {
+        cairo_move_to(cr, (i % columns) * 190 + (f % 4) * 0.25,
+                      (i / columns) * 21);
+        draw(layouts[static_cast<std::size_t>(i) % layouts.size()]);
+      }
+
+    cairo_surface_flush(surface);
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    double count = static_cast<double>(frames) * columns * rows;
+
+    std::cout << name << ": " << count / elapsed.count() << " labels/s, "
+              << elapsed.count() * 1000.0 / frames << " ms/frame"
+              << std::endl;
+  };
+
+  measure("pango_cairo_show_layout",
+          [&](PangoLayout *layout) { pango_cairo_show_layout(cr, layout); });
+
+  glyph_atlas_t &atlas = glyph_atlas_t::instance();
+  measure("glyph_atlas_t", [&](PangoLayout *layout) {
+    atlas.show_layout(cr, layout);
+  });
+
+  std::cout << "atlas hits " << atlas.hits << ", misses " << atlas.misses
+            << std::endl;
+
+  for (auto layout : layouts)
+    g_object_unref(layout);
+  pango_font_description_free(description);
+  cairo_destroy(cr);
+  cairo_surface_destroy(surface);
+
+  return 0;
+}
@@ -0,0 +1,178 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @author Anthony Matarazzo
+ * @file hit_index.cpp
+ * @date 10/18/26
+ * @version 1.0
+ * @brief quad tree over the ink rectangles of the visuals for pointer hit
+ * testing.
+ */
+// clang-format off
+
+#include <base/unit_object.h>
+#include "hit_index.h"
+
+// clang-format on
+
+/**
+ * @internal
+ * @fn hit_index_t
+ * @param std::vector<item_t> &&_items
+ * @brief the root covers the extents of all items. Within each node the items
+ * are kept with the top most first.
+ */
+uxdevice::hit_index_t::hit_index_t(std::vector<item_t> &&_items)
+    : items(std::move(_items)) {
+  if (items.empty())
+    return;
+
+  int x1 = items.front().r.x, y1 = items.front().r.y;
+  int x2 = x1 + items.front().r.width, y2 = y1 + items.front().r.height;
+
+  for (auto &n : items) {
+    x1 = std::min(x1, n.r.x);
+    y1 = std::min(y1, n.r.y);
+    x2 = std::max(x2, n.r.x + n.r.width);
+    y2 = std::max(y2, n.r.y + n.r.height);
+  }
+
+  nodes.reserve(items.size() / 4 + 1);
+  nodes.emplace_back();
+  nodes.front().bounds = {x1, y1, x2 - x1, y2 - y1};
+
+  for (std::size_t i = 0; i < items.size(); i++)
+    insert(i);
+
+  for (auto &node : nodes)
+    std::sort(node.held.begin(), node.held.end(),
+              [&](auto a, auto b) { return items[a].z > items[b].z; });
+}
+
+/**
+ * @internal
+ * @fn insert
+ * @param std::size_t item
+ * @brief descends while one quadrant holds the whole rectangle, creating
+ * the nodes as needed.
+ */
+void uxdevice::hit_index_t::insert(std::size_t item) {
+  const auto &r = items[item].r;
+  std::size_t n = 0;
+
+  for (int depth = 0; depth < max_depth; depth++) {
+    const auto b = nodes[n].bounds;
+    if (b.width / 2 < min_extent || b.height / 2 < min_extent)
+      break;
+
+    int q = 0;
+    while (q < 4 && !contains(quadrant(b, q), r))
+      q++;
+    if (q == 4)
+      break;
+
+    if (nodes[n].child[q] == -1) {
+      nodes[n].child[q] = static_cast<int>(nodes.size());
+      nodes.emplace_back();
+      nodes.back().bounds = quadrant(b, q);
+    }
+    n = static_cast<std::size_t>(nodes[n].child[q]);
+  }
+
+  nodes[n].held.emplace_back(item);
+}
+
+/**
+ * @internal
+ * @fn query
+ * @param double x
+ * @param double y
+ * @param const hit_refine_t &refine
+ * @brief follows the quadrants holding the point from the root. Without a
+ * refine function, the first holding item of each node is its top most
+ * and only those are compared. With one, the candidates are tried from the
+ * top.
+ * @return std::shared_ptr<display_visual_t> - empty when nothing is hit.
+ */
+std::shared_ptr<uxdevice::display_visual_t>
+uxdevice::hit_index_t::query(double x, double y,
+                             const hit_refine_t &refine) const {
+  std::vector<std::size_t> candidates = {};
+  int n = nodes.empty() || !contains(nodes.front().bounds, x, y) ? -1 : 0;
+
+  while (n != -1) {
+    const auto &node = nodes[static_cast<std::size_t>(n)];
+
+    for (auto i : node.held)
+      if (contains(items[i].r, x, y)) {
+        candidates.emplace_back(i);
+        if (!refine)
+          break;
+      }
+
+    int next = -1;
+    for (int q = 0; q < 4 && next == -1; q++)
+      if (node.child[q] != -1 &&
+          contains(nodes[static_cast<std::size_t>(node.child[q])].bounds, x,
+                   y))
+        next = node.child[q];
+    n = next;
+  }
+
+  std::sort(candidates.begin(), candidates.end(),
+            [&](auto a, auto b) { return items[a].z > items[b].z; });
+
+  for (auto i : candidates) {
+    auto visual = items[i].visual.lock();
+    if (visual && (!refine || refine(visual, x, y)))
+      return visual;
+  }
+
+  return {};
+}
+
+/**
+ * @internal
+ * @fn quadrant
+ * @brief 0 top left, 1 top right, 2 bottom left, 3 bottom right. The right
+ * and bottom quadrants take the odd pixel.
+ */
+cairo_rectangle_int_t
+uxdevice::hit_index_t::quadrant(const cairo_rectangle_int_t &b, int q) {
+  int hw = b.width / 2, hh = b.height / 2;
+  int x = q & 1 ? b.x + hw : b.x;
+  int y = q & 2 ? b.y + hh : b.y;
+  int w = q & 1 ? b.width - hw : hw;
+  int h = q & 2 ? b.height - hh : hh;
+
+  return {x, y, w, h};
+}
+
+bool uxdevice::hit_index_t::contains(
+    const cairo_rectangle_int_t &outer,
+    const cairo_rectangle_int_t &inner) noexcept {
+  return inner.x >= outer.x && inner.y >= outer.y &&
+         inner.x + inner.width <= outer.x + outer.width &&
+         inner.y + inner.height <= outer.y + outer.height;
+}
+
+bool uxdevice::hit_index_t::contains(const cairo_rectangle_int_t &r,
+                                     double x, double y) noexcept {
+  return x >= r.x && y >= r.y && x < r.x + r.width && y < r.y + r.height;
+}
@@ -0,0 +1,96 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @author Anthony Matarazzo
+ * @file hit_index.h
+ * @date 10/18/26
+ * @version 1.0
+ * @brief quad tree over the ink rectangles of the visuals for pointer hit
+ * testing.
+ * @details The display context builds the index from the published scene
+ * when a hit test follows a change. Each visual is held by the deepest node
+ * whose quadrant contains its whole rectangle, so a point query visits one
+ * node per level. z is the position within the scene, the last drawn is on
+ * top.
+ */
+
+#pragma once
+
+namespace uxdevice {
+
+class display_visual_t;
+
+/**
+ * @internal
+ * @typedef hit_refine_t
+ * @brief optional test of a visual whose ink rectangle holds the point, such
+ * as redrawing its path and asking cairo_in_fill. Returning false passes the
+ * hit to the visual beneath.
+ */
+typedef std::function<bool(const std::shared_ptr<display_visual_t> &,
+                           double x, double y)>
+    hit_refine_t;
+
+/**
+ * @internal
+ * @class hit_index_t
+ * @brief built once, then read from any thread.
+ */
+class hit_index_t {
+public:
+  class item_t {
+  public:
+    cairo_rectangle_int_t r = {};
+    std::size_t z = {};
+    std::weak_ptr<display_visual_t> visual = {};
+  };
+
+  hit_index_t() {}
+  hit_index_t(std::vector<item_t> &&_items);
+
+  std::shared_ptr<display_visual_t>
+  query(double x, double y, const hit_refine_t &refine = {}) const;
+
+  std::size_t size(void) const noexcept { return items.size(); }
+
+  /// @brief quadrants are not divided past this depth or below this size.
+  static const int max_depth = 12;
+  static const int min_extent = 8;
+
+private:
+  class node_t {
+  public:
+    cairo_rectangle_int_t bounds = {};
+    std::vector<std::size_t> held = {};
+    std::array<int, 4> child = {-1, -1, -1, -1};
+  };
+
+  void insert(std::size_t item);
+  static cairo_rectangle_int_t quadrant(const cairo_rectangle_int_t &b,
+                                        int q);
+  static bool contains(const cairo_rectangle_int_t &outer,
+                       const cairo_rectangle_int_t &inner) noexcept;
+  static bool contains(const cairo_rectangle_int_t &r, double x,
+                       double y) noexcept;
+
+  std::vector<item_t> items = {};
+  std::vector<node_t> nodes = {};
+};
+
+} // namespace uxdevice
@@ -55,9 +55,14 @@ uxdevice::context_cairo_region_t::context_cairo_region_t(
   *this = other;
 }
 
-uxdevice::context_cairo_region_t::context_cairo_region_t &
-operator=(const context_cairo_region_t &other) {
-  _ptr = cairo_region_reference(other._ptr);
+uxdevice::context_cairo_region_t &uxdevice::context_cairo_region_t::operator=(
+    const context_cairo_region_t &other) {
+  if (this == &other)
+    return *this;
+
+  if (_ptr)
+    cairo_region_destroy(_ptr);
+  _ptr = other._ptr ? cairo_region_reference(other._ptr) : nullptr;
   rect = other.rect;
   _rect = other._rect;
   obj = other.obj;
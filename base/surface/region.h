@@ -40,6 +40,7 @@ public:
   context_cairo_region_t(bool bOS, int x, int y, int w, int h);
   context_cairo_region_t(std::size_t _obj, int x, int y, int w, int h);
   context_cairo_region_t(const context_cairo_region_t &other);
+  context_cairo_region_t &operator=(const context_cairo_region_t &other);
   ~context_cairo_region_t();
 
   cairo_rectangle_int_t rect = {};
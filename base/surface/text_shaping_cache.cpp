@@ -0,0 +1,359 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @author Anthony Matarazzo
+ * @file text_shaping_cache.cpp
+ * @date 10/18/26
+ * @version 1.0
+ * @brief per render thread cache of shaped PangoLayout objects.
+ */
+// clang-format off
+
+#include <base/unit_object.h>
+#include "text_shaping_cache.h"
+
+// clang-format on
+
+/**
+ * @internal
+ * @var shaped_layout_quark
+ * @brief names the shaped layout attached to a source layout.
+ */
+static GQuark shaped_layout_quark(void) {
+  static GQuark quark = g_quark_from_static_string("uxdevice-shaped-layout");
+  return quark;
+}
+
+/**
+ * @internal
+ * @fn text_shaping_key_t
+ * @param PangoLayout *layout
+ * @param bool btext - when false, the text is not part of the key. Used to
+ * compare the paragraph settings of layouts.
+ * @brief reads the shaping parameters from the layout. The font description
+ * and the tab array are copied by value.
+ */
+uxdevice::text_shaping_key_t::text_shaping_key_t(PangoLayout *layout,
+                                                 bool btext)
+    : text(btext ? pango_layout_get_text(layout) : ""),
+      font(pango_font_description_copy(
+          pango_layout_get_font_description(layout))),
+      width(pango_layout_get_width(layout)),
+      height(pango_layout_get_height(layout)),
+      indent(pango_layout_get_indent(layout)),
+      spacing(pango_layout_get_spacing(layout)),
+      line_spacing(pango_layout_get_line_spacing(layout)),
+      alignment(pango_layout_get_alignment(layout)),
+      justify(pango_layout_get_justify(layout)),
+      ellipsize(pango_layout_get_ellipsize(layout)),
+      wrap(pango_layout_get_wrap(layout)) {
+
+  PangoTabArray *tab_array = pango_layout_get_tabs(layout);
+  if (tab_array) {
+    for (int i = 0; i < pango_tab_array_get_size(tab_array); i++) {
+      PangoTabAlign tab_align = {};
+      int location = {};
+      pango_tab_array_get_tab(tab_array, i, &tab_align, &location);
+      tabs.emplace_back(location);
+    }
+    pango_tab_array_free(tab_array);
+  }
+
+  /** @brief the font options and resolution of the pango context change the
+   * hinting and size of the glyphs.*/
+  PangoContext *context = pango_layout_get_context(layout);
+  resolution = pango_cairo_context_get_resolution(context);
+  const cairo_font_options_t *options =
+      pango_cairo_context_get_font_options(context);
+  if (options)
+    font_options = cairo_font_options_copy(options);
+}
+
+uxdevice::text_shaping_key_t::~text_shaping_key_t() {
+  if (font)
+    pango_font_description_free(font);
+  if (font_options)
+    cairo_font_options_destroy(font_options);
+}
+
+/// @brief copy constructor
+uxdevice::text_shaping_key_t::text_shaping_key_t(
+    const text_shaping_key_t &other)
+    : text(other.text), font(pango_font_description_copy(other.font)),
+      width(other.width), height(other.height), indent(other.indent),
+      spacing(other.spacing), line_spacing(other.line_spacing),
+      alignment(other.alignment), justify(other.justify),
+      ellipsize(other.ellipsize), wrap(other.wrap), tabs(other.tabs),
+      resolution(other.resolution),
+      font_options(other.font_options
+                       ? cairo_font_options_copy(other.font_options)
+                       : nullptr) {}
+
+/// @brief move constructor
+uxdevice::text_shaping_key_t::text_shaping_key_t(
+    text_shaping_key_t &&other) noexcept
+    : text(std::move(other.text)), font(other.font), width(other.width),
+      height(other.height), indent(other.indent), spacing(other.spacing),
+      line_spacing(other.line_spacing), alignment(other.alignment),
+      justify(other.justify), ellipsize(other.ellipsize), wrap(other.wrap),
+      tabs(std::move(other.tabs)), resolution(other.resolution),
+      font_options(other.font_options) {
+  other.font = nullptr;
+  other.font_options = nullptr;
+}
+
+/// @brief copy assignment
+uxdevice::text_shaping_key_t &
+uxdevice::text_shaping_key_t::operator=(const text_shaping_key_t &other) {
+  if (this == &other)
+    return *this;
+
+  if (font)
+    pango_font_description_free(font);
+  if (font_options)
+    cairo_font_options_destroy(font_options);
+
+  text = other.text;
+  font = pango_font_description_copy(other.font);
+  width = other.width;
+  height = other.height;
+  indent = other.indent;
+  spacing = other.spacing;
+  line_spacing = other.line_spacing;
+  alignment = other.alignment;
+  justify = other.justify;
+  ellipsize = other.ellipsize;
+  wrap = other.wrap;
+  tabs = other.tabs;
+  resolution = other.resolution;
+  font_options = other.font_options
+                     ? cairo_font_options_copy(other.font_options)
+                     : nullptr;
+  return *this;
+}
+
+/// @brief move assignment
+uxdevice::text_shaping_key_t &
+uxdevice::text_shaping_key_t::operator=(text_shaping_key_t &&other) noexcept {
+  if (this == &other)
+    return *this;
+
+  if (font)
+    pango_font_description_free(font);
+  if (font_options)
+    cairo_font_options_destroy(font_options);
+
+  text = std::move(other.text);
+  font = other.font;
+  other.font = nullptr;
+  width = other.width;
+  height = other.height;
+  indent = other.indent;
+  spacing = other.spacing;
+  line_spacing = other.line_spacing;
+  alignment = other.alignment;
+  justify = other.justify;
+  ellipsize = other.ellipsize;
+  wrap = other.wrap;
+  tabs = std::move(other.tabs);
+  resolution = other.resolution;
+  font_options = other.font_options;
+  other.font_options = nullptr;
+  return *this;
+}
+
+/**
+ * @internal
+ * @fn operator==
+ * @param const text_shaping_key_t &other
+ * @brief the font descriptions and the font options are compared by value.
+ */
+bool uxdevice::text_shaping_key_t::operator==(
+    const text_shaping_key_t &other) const noexcept {
+  bool bfont = font == other.font ||
+               (font && other.font &&
+                pango_font_description_equal(font, other.font));
+  bool boptions = font_options == other.font_options ||
+                  (font_options && other.font_options &&
+                   cairo_font_options_equal(font_options, other.font_options));
+
+  return bfont && boptions && width == other.width && height == other.height &&
+         indent == other.indent && spacing == other.spacing &&
+         line_spacing == other.line_spacing && alignment == other.alignment &&
+         justify == other.justify && ellipsize == other.ellipsize &&
+         wrap == other.wrap && resolution == other.resolution &&
+         tabs == other.tabs &&
+         text == other.text;
+}
+
+/**
+ * @internal
+ * @fn hash_code
+ * @brief hash of the key.
+ * @return std::size_t
+ */
+std::size_t uxdevice::text_shaping_key_t::hash_code(void) const noexcept {
+  std::size_t __value = {};
+  hash_combine(__value, text, width, height, indent, spacing, line_spacing,
+               static_cast<int>(alignment), justify,
+               static_cast<int>(ellipsize), static_cast<int>(wrap), resolution);
+
+  if (font)
+    hash_combine(__value, pango_font_description_hash(font));
+
+  if (font_options)
+    hash_combine(__value, cairo_font_options_hash(font_options));
+
+  for (auto location : tabs)
+    hash_combine(__value, location);
+
+  return __value;
+}
+
+/**
+ * @internal
+ * @fn instance
+ * @brief the cache of the calling render thread. The layouts are released
+ * when the thread exits.
+ */
+uxdevice::text_shaping_cache_t &uxdevice::text_shaping_cache_t::instance(void) {
+  static thread_local text_shaping_cache_t cache;
+  return cache;
+}
+
+uxdevice::text_shaping_cache_t::~text_shaping_cache_t() { clear(); }
+
+/**
+ * @internal
+ * @fn shape
+ * @param PangoLayout *layout
+ * @param PangoRectangle *ink_rect
+ * @param PangoRectangle *logical_rect
+ * @brief finds or creates the shaped layout for the parameters of the given
+ * layout. The pixel extents are returned. Layouts that carry an attribute list
+ * are not cached as the list is not part of the key. These are shaped in place
+ * and the function returns false.
+ * @return bool - true when the shaped layout is shared from the cache.
+ */
+bool uxdevice::text_shaping_cache_t::shape(PangoLayout *layout,
+                                           PangoRectangle *ink_rect,
+                                           PangoRectangle *logical_rect) {
+  if (pango_layout_get_attributes(layout)) {
+    attach(layout, nullptr);
+    pango_layout_get_pixel_extents(layout, ink_rect, logical_rect);
+    return false;
+  }
+
+  text_shaping_key_t key(layout);
+
+  auto it = storage.find(key);
+  if (it != storage.end()) {
+    hits++;
+    lru_storage.splice(lru_storage.begin(), lru_storage, it->second.lru);
+
+  } else {
+    misses++;
+
+    /** @brief pango_layout_copy copies the text, attributes and tabs by value
+     * and shares the context. Requesting the extents performs the shaping
+     * once for all layouts having the same key.*/
+    text_shaping_entry_t entry = {};
+    entry.layout = pango_layout_copy(layout);
+    pango_layout_get_pixel_extents(entry.layout, &entry.ink_rect,
+                                   &entry.logical_rect);
+
+    it = storage.emplace(std::move(key), entry).first;
+    lru_storage.emplace_front(&it->first);
+    it->second.lru = lru_storage.begin();
+
+    evict();
+  }
+
+  *ink_rect = it->second.ink_rect;
+  *logical_rect = it->second.logical_rect;
+  attach(layout, it->second.layout);
+
+  return true;
+}
+
+/**
+ * @internal
+ * @fn shaped
+ * @param PangoLayout *layout
+ * @brief returns the shaped layout attached to the layout. If one is not
+ * attached, the layout itself is returned. The render units call this to draw.
+ */
+PangoLayout *uxdevice::text_shaping_cache_t::shaped(PangoLayout *layout) {
+  auto shaped_layout = static_cast<PangoLayout *>(
+      g_object_get_qdata(G_OBJECT(layout), shaped_layout_quark()));
+  return shaped_layout ? shaped_layout : layout;
+}
+
+/**
+ * @internal
+ * @fn detach
+ * @param PangoLayout *layout
+ * @brief releases the shaped layout so the layout itself is drawn.
+ */
+void uxdevice::text_shaping_cache_t::detach(PangoLayout *layout) {
+  g_object_set_qdata(G_OBJECT(layout), shaped_layout_quark(), nullptr);
+}
+
+/**
+ * @internal
+ * @fn attach
+ * @param PangoLayout *layout
+ * @param PangoLayout *shaped_layout
+ * @brief holds a reference to the shaped layout within the source layout.
+ * The previous reference is released by the destroy notify.
+ */
+void uxdevice::text_shaping_cache_t::attach(PangoLayout *layout,
+                                            PangoLayout *shaped_layout) {
+  if (shaped_layout)
+    g_object_set_qdata_full(G_OBJECT(layout), shaped_layout_quark(),
+                            g_object_ref(shaped_layout), g_object_unref);
+  else
+    g_object_set_qdata(G_OBJECT(layout), shaped_layout_quark(), nullptr);
+}
+
+/**
+ * @internal
+ * @fn evict
+ * @brief removes the least recently used entries above capacity.
+ */
+void uxdevice::text_shaping_cache_t::evict(void) {
+  while (storage.size() > capacity) {
+    auto it = storage.find(*lru_storage.back());
+    lru_storage.pop_back();
+    g_object_unref(it->second.layout);
+    storage.erase(it);
+  }
+}
+
+/**
+ * @internal
+ * @fn clear
+ * @brief releases all of the cached layouts.
+ */
+void uxdevice::text_shaping_cache_t::clear(void) {
+  for (auto &n : storage)
+    g_object_unref(n.second.layout);
+  storage.clear();
+  lru_storage.clear();
+}
@@ -0,0 +1,143 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @author Anthony Matarazzo
+ * @file text_shaping_cache.h
+ * @date 10/18/26
+ * @version 1.0
+ * @brief per render thread cache of shaped PangoLayout objects.
+ * @details Identical strings such as column headers, repeated values or
+ * numbers are common within a surface. Each textual_render_t owns a layout
+ * that receives the attribute units. Rather than shaping each of these layouts
+ * through harfbuzz, the parameters that influence shaping are used as a key.
+ * The first layout with the key is copied and shaped, the remaining ones draw
+ * the shaped copy.
+ */
+
+#pragma once
+
+namespace uxdevice {
+
+/**
+ * @internal
+ * @class text_shaping_key_t
+ * @brief the layout parameters that determine the shaped glyph runs. Two
+ * layouts with an equal key produce the same lines so the lines of one may be
+ * drawn in place of the other. The key is read directly from the layout after
+ * the attribute units have been emitted to it.
+ */
+class text_shaping_key_t {
+public:
+  text_shaping_key_t() {}
+  text_shaping_key_t(PangoLayout *layout, bool btext = true);
+  ~text_shaping_key_t();
+
+  /// @brief copy constructor
+  text_shaping_key_t(const text_shaping_key_t &other);
+
+  /// @brief move constructor
+  text_shaping_key_t(text_shaping_key_t &&other) noexcept;
+
+  /// @brief copy assignment
+  text_shaping_key_t &operator=(const text_shaping_key_t &other);
+
+  /// @brief move assignment
+  text_shaping_key_t &operator=(text_shaping_key_t &&other) noexcept;
+
+  bool operator==(const text_shaping_key_t &other) const noexcept;
+
+  std::size_t hash_code(void) const noexcept;
+
+  std::string text = {};
+  PangoFontDescription *font = {};
+  int width = {};
+  int height = {};
+  int indent = {};
+  int spacing = {};
+  double line_spacing = {};
+  PangoAlignment alignment = PANGO_ALIGN_LEFT;
+  bool justify = {};
+  PangoEllipsizeMode ellipsize = PANGO_ELLIPSIZE_NONE;
+  PangoWrapMode wrap = PANGO_WRAP_WORD;
+  std::vector<int> tabs = {};
+  double resolution = {};
+  cairo_font_options_t *font_options = {};
+};
+
+} // namespace uxdevice
+
+UX_REGISTER_STD_HASH_SPECIALIZATION(uxdevice::text_shaping_key_t)
+
+namespace uxdevice {
+
+/**
+ * @internal
+ * @class text_shaping_entry_t
+ * @brief a shaped layout and its pixel metrics. The lru iterator notes the
+ * position of the key within the eviction order.
+ */
+class text_shaping_entry_t {
+public:
+  PangoLayout *layout = {};
+  PangoRectangle ink_rect = PangoRectangle();
+  PangoRectangle logical_rect = PangoRectangle();
+  std::list<const text_shaping_key_t *>::iterator lru = {};
+};
+
+/**
+ * @internal
+ * @class text_shaping_cache_t
+ * @brief the cache of the calling render thread. Each render thread owns its
+ * cache so a shaped layout, which shares the pango context of the layout it
+ * was copied from, is never shaped or drawn by two threads at once. The
+ * shape() function is called by the textual_render_t object when the serial
+ * number of its layout changes. The shaped layout is attached to the source
+ * layout so that the render units, text_render_normal_t and
+ * text_render_path_t, draw the shared glyph runs by calling shaped(). Entries
+ * are evicted least recently used. An evicted layout stays alive while it is
+ * attached to a source layout.
+ */
+class text_shaping_cache_t {
+public:
+  static text_shaping_cache_t &instance(void);
+
+  bool shape(PangoLayout *layout, PangoRectangle *ink_rect,
+             PangoRectangle *logical_rect);
+
+  static PangoLayout *shaped(PangoLayout *layout);
+  static void detach(PangoLayout *layout);
+
+  void clear(void);
+
+  std::size_t capacity = 4096;
+  std::size_t hits = {};
+  std::size_t misses = {};
+
+private:
+  text_shaping_cache_t() {}
+  ~text_shaping_cache_t();
+
+  void attach(PangoLayout *layout, PangoLayout *shaped_layout);
+  void evict(void);
+
+  std::unordered_map<text_shaping_key_t, text_shaping_entry_t> storage = {};
+  std::list<const text_shaping_key_t *> lru_storage = {};
+};
+
+} // namespace uxdevice
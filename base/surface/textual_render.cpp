@@ -49,6 +49,8 @@ void uxdevice::textual_render_t::emit(display_context_t *context) {
     pipeline_memory_linkages(context, textual_render_normal_bits);
   else if (context->pipeline_memory_access<text_render_path_t>())
     pipeline_memory_linkages(context, textual_render_path_bits);
+  else if (context->pipeline_memory_access<text_render_atlas_t>())
+    pipeline_memory_linkages(context, textual_render_normal_bits);
 
   // this adds a parameter for the specific object
   pipeline_memory_store<PangoLayout *>(layout);
@@ -100,6 +100,23 @@ std::size_t uxdevice::textual_render_storage_t::hash_code(void) const noexcept {
   return __value;
 }
 
+/**
+ * @internal
+ * @fn textual_render_storage_t::hash_generation
+ * @brief the generation of the object combined with the linked attributes.
+ */
+std::size_t
+uxdevice::textual_render_storage_t::hash_generation(void) const noexcept {
+  std::size_t __value = hash_members_t::hash_generation();
+  hash_combine(__value, pipeline_memory_hash_generation());
+  return __value;
+}
+
+/// @brief hashed each test when a linked attribute is volatile.
+bool uxdevice::textual_render_storage_t::hash_volatile(void) const noexcept {
+  return hash_members_t::hash_volatile() || pipeline_memory_hash_volatile();
+}
+
 /**
  * @internal
  * @fn textual_render_storage_t::pipeline_acquire
@@ -151,8 +168,30 @@ void uxdevice::textual_render_storage_t::pipeline_acquire() {
   pipeline_push<order_render_option>(fn_emit_cr_t{[&](auto cr) {
     // any changes
     if (layout_serial != pango_layout_get_serial(layout)) {
+      /** a number whose digits changed in place is the only change. The
+       * extents are kept and the layout is drawn unshaped rather than adding
+       * each reading to the shaping cache. The serials noted around the
+       * number's text must span the whole change of this pass.*/
+      auto stable = static_cast<text_number_t::metrics_stable_t *>(
+          g_object_get_qdata(G_OBJECT(layout),
+                             text_number_t::metrics_stable_quark()));
+      bool bstable = stable && stable->version != 0 &&
+                     stable->serial_before == layout_serial &&
+                     stable->serial_after == pango_layout_get_serial(layout);
+      if (stable)
+        stable->version = 0;
+
+      if (has_ink_extents && bstable) {
+        text_shaping_cache_t::detach(layout);
+        return;
+      }
+
       auto coordinate = pipeline_memory_access<coordinate_t>();
-      pango_layout_get_pixel_extents(layout, &ink_rect, &logical_rect);
+
+      /** the context options are applied before the key is read from the
+       * layout. Layouts having equal parameters share the shaped lines.*/
+      pango_cairo_update_layout(cr, layout);
+      text_shaping_cache_t::instance().shape(layout, &ink_rect, &logical_rect);
       int tw = std::min((double)logical_rect.width, coordinate->w);
       int th = std::min((double)logical_rect.height, coordinate->h);
       ink_rectangle = {(int)coordinate->x, (int)coordinate->y, tw, th};
@@ -161,7 +200,6 @@ void uxdevice::textual_render_storage_t::pipeline_acquire() {
                               (double)ink_rectangle.height};
 
       has_ink_extents = true;
-      pango_cairo_update_layout(cr, layout);
     }
   }});
 
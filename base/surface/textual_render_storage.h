@@ -63,6 +63,10 @@ public:
   bool pipeline_has_required_linkages(void);
   std::size_t hash_code(void) const noexcept;
 
+  /// @brief linked attributes are part of the change detection.
+  std::size_t hash_generation(void) const noexcept;
+  bool hash_volatile(void) const noexcept;
+
   PangoLayout *layout = nullptr;
   guint layout_serial = {};
   PangoRectangle ink_rect = PangoRectangle();
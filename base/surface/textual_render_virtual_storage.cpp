@@ -0,0 +1,585 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @author Anthony Matarazzo
+ * @file textual_render_virtual_storage.cpp
+ * @date 10/18/26
+ * @version 1.0
+ * @brief storage for the virtualized textual render.
+ */
+// clang-format off
+
+#include <base/unit_object.h>
+#include "textual_render_virtual_storage.h"
+
+// clang-format on
+
+uxdevice::textual_render_virtual_storage_t::
+    textual_render_virtual_storage_t() {}
+
+uxdevice::textual_render_virtual_storage_t::
+    ~textual_render_virtual_storage_t() {
+  release_all();
+  if (layout)
+    g_object_unref(layout);
+}
+
+/// @brief move constructor
+uxdevice::textual_render_virtual_storage_t::textual_render_virtual_storage_t(
+    textual_render_virtual_storage_t &&other) noexcept
+    : hash_members_t(other), system_error_t(other), display_visual_t(other),
+      pipeline_memory_t(other), layout(other.layout),
+      block_line_limit(other.block_line_limit), margin(other.margin),
+      refine_per_frame(other.refine_per_frame), bpath_mode(other.bpath_mode),
+      batlas_mode(other.batlas_mode), blocks(std::move(other.blocks)),
+      text(std::move(other.text)), text_hash(other.text_hash),
+      source_id(other.source_id), source_version(other.source_version) {
+  other.layout = nullptr;
+  other.blocks.clear();
+  other.source_id = 0;
+}
+
+/// @brief copy constructor. The blocks are rebuilt from the copied layout on
+/// the first render.
+uxdevice::textual_render_virtual_storage_t::textual_render_virtual_storage_t(
+    const textual_render_virtual_storage_t &other)
+    : hash_members_t(other), system_error_t(other), display_visual_t(other),
+      pipeline_memory_t(other), block_line_limit(other.block_line_limit),
+      margin(other.margin), refine_per_frame(other.refine_per_frame),
+      bpath_mode(other.bpath_mode), batlas_mode(other.batlas_mode) {
+  if (other.layout)
+    layout = pango_layout_copy(other.layout);
+}
+
+/// @brief copy assignment
+uxdevice::textual_render_virtual_storage_t &
+uxdevice::textual_render_virtual_storage_t::operator=(
+    const textual_render_virtual_storage_t &other) {
+  if (this == &other)
+    return *this;
+
+  hash_members_t::operator=(other);
+  system_error_t::operator=(other);
+  display_visual_t::operator=(other);
+  pipeline_memory_t::operator=(other);
+
+  release_all();
+  blocks.clear();
+  if (layout)
+    g_object_unref(layout);
+  layout = other.layout ? pango_layout_copy(other.layout) : nullptr;
+  layout_serial = {};
+  block_line_limit = other.block_line_limit;
+  margin = other.margin;
+  refine_per_frame = other.refine_per_frame;
+  bpath_mode = other.bpath_mode;
+  batlas_mode = other.batlas_mode;
+  return *this;
+}
+
+/// @brief move assignment
+uxdevice::textual_render_virtual_storage_t &
+uxdevice::textual_render_virtual_storage_t::operator=(
+    textual_render_virtual_storage_t &&other) noexcept {
+  if (this == &other)
+    return *this;
+
+  hash_members_t::operator=(other);
+  system_error_t::operator=(other);
+  display_visual_t::operator=(other);
+  pipeline_memory_t::operator=(other);
+
+  release_all();
+  if (layout)
+    g_object_unref(layout);
+  layout = other.layout;
+  other.layout = nullptr;
+  layout_serial = {};
+  blocks = std::move(other.blocks);
+  other.blocks.clear();
+  text = std::move(other.text);
+  text_hash = other.text_hash;
+  source_id = other.source_id;
+  source_version = other.source_version;
+  other.source_id = 0;
+  block_line_limit = other.block_line_limit;
+  margin = other.margin;
+  refine_per_frame = other.refine_per_frame;
+  bpath_mode = other.bpath_mode;
+  batlas_mode = other.batlas_mode;
+  return *this;
+}
+
+/**
+ * @internal
+ * @fn textual_render_virtual_storage_t::hash_code(void)
+ * @brief the hash does not read the text. The layout serial and the block
+ * heights note the changes.
+ * @return std::size_t the hash value
+ */
+std::size_t
+uxdevice::textual_render_virtual_storage_t::hash_code(void) const noexcept {
+  std::size_t __value = {};
+  hash_combine(__value,
+               std::type_index(typeid(textual_render_virtual_storage_t)),
+               layout ? pango_layout_get_serial(layout) : 0, total_height,
+               ink_rectangle.x, ink_rectangle.y, ink_rectangle.width,
+               ink_rectangle.height, matrix.hash_code(),
+               pipeline_memory_hash_code());
+  return __value;
+}
+
+/**
+ * @internal
+ * @fn textual_render_virtual_storage_t::hash_generation
+ * @brief the generation of the object combined with the linked attributes.
+ */
+std::size_t uxdevice::textual_render_virtual_storage_t::hash_generation(
+    void) const noexcept {
+  std::size_t __value = hash_members_t::hash_generation();
+  hash_combine(__value, pipeline_memory_hash_generation());
+  return __value;
+}
+
+/// @brief hashed each test when a linked attribute is volatile.
+bool uxdevice::textual_render_virtual_storage_t::hash_volatile(
+    void) const noexcept {
+  return hash_members_t::hash_volatile() || pipeline_memory_hash_volatile();
+}
+
+/**
+ * @internal
+ * @fn textual_render_virtual_storage_t::pipeline_acquire
+ * @brief the pipeline follows textual_render_storage_t. The layout option
+ * stage applies the attribute units, except the text, to the template layout.
+ * The render option stage updates the blocks and the ink area. Rather than
+ * drawing the template, the render stage draws the visible blocks.
+ */
+void uxdevice::textual_render_virtual_storage_t::pipeline_acquire() {
+  pipeline_push<order_init>(fn_emit_cr_t{[&](auto cr) {
+    if (!layout)
+      layout = pango_cairo_create_layout(cr);
+  }});
+
+  pipeline_push<order_layout_option>(fn_emit_layout_t{[&](auto layout) {
+    layout_serial = pango_layout_get_serial(layout);
+  }});
+
+  /** @brief the text is read by synchronize_text rather than set on the
+   * template, which would compare or copy all of it each frame.*/
+  pipeline_push_visit_except<text_data_t, fn_emit_layout_t>();
+
+  pipeline_push<order_render_option>(fn_emit_cr_t{[&](auto cr) {
+    if (layout_serial != pango_layout_get_serial(layout) || blocks.empty()) {
+      pango_cairo_update_layout(cr, layout);
+      synchronize();
+    }
+    synchronize_text();
+
+    /** @brief estimates refined here move the blocks before the ink area is
+     * taken, so the damage of this frame includes them.*/
+    refine();
+
+    if (bposition || !has_ink_extents) {
+      position();
+
+      auto coordinate = pipeline_memory_access<coordinate_t>();
+      double tw = coordinate->w;
+      if (pango_layout_get_width(layout) > 0)
+        tw = std::min(tw, (double)pango_layout_get_width(layout) / PANGO_SCALE);
+      double th = std::min(total_height, coordinate->h);
+
+      ink_rectangle = {(int)coordinate->x, (int)coordinate->y, (int)tw,
+                       (int)th};
+      ink_rectangle_double = {(double)ink_rectangle.x, (double)ink_rectangle.y,
+                              (double)ink_rectangle.width,
+                              (double)ink_rectangle.height};
+      has_ink_extents = true;
+    }
+  }});
+
+  pipeline_push<order_render>(
+      fn_emit_cr_a_t{[&](cairo_t *cr, coordinate_t *a) { draw(cr, a); }});
+
+  pipeline_push_visit<fn_emit_cr_a_t>();
+}
+
+/**
+ * @internal
+ * @fn textual_render_virtual_storage_t::pipeline_has_required_linkages
+ * @brief the same attributes as textual_render_t are required.
+ * @return bool
+ */
+bool uxdevice::textual_render_virtual_storage_t::
+    pipeline_has_required_linkages(void) {
+  if (!((pipeline_memory_access<text_color_t>() ||
+         pipeline_memory_access<text_outline_t>() ||
+         pipeline_memory_access<text_fill_t>()) &&
+        pipeline_memory_access<coordinate_t>() &&
+        pipeline_memory_access<text_data_t>() &&
+        pipeline_memory_access<text_font_t>())) {
+    const char *s = "A textual_render_virtual_t object must include the "
+                    "following attributes: A text_color_t, text_outline_t or "
+                    " text_fill_t. As well, a coordinate_t, text and "
+                    "text_font_t object.";
+    error_report(s);
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @internal
+ * @fn synchronize
+ * @brief called when the serial number of the template layout changes. A
+ * change of the paragraph settings, font or width, invalidates the layout of
+ * every block.
+ */
+void uxdevice::textual_render_virtual_storage_t::synchronize(void) {
+  text_shaping_key_t key(layout, false);
+  if (key == paragraph_key)
+    return;
+
+  paragraph_key = std::move(key);
+  release_all();
+  for (auto &block : blocks)
+    block.measured = false;
+
+  measured_height = 0;
+  measured_lines = 0;
+
+  PangoFontMetrics *metrics = pango_context_get_metrics(
+      pango_layout_get_context(layout),
+      pango_layout_get_font_description(layout), nullptr);
+  line_height = (double)(pango_font_metrics_get_ascent(metrics) +
+                         pango_font_metrics_get_descent(metrics)) /
+                PANGO_SCALE;
+  pango_font_metrics_unref(metrics);
+
+  if (pango_layout_get_line_spacing(layout) > 0)
+    line_height *= pango_layout_get_line_spacing(layout);
+
+  bposition = true;
+}
+
+/**
+ * @internal
+ * @fn synchronize_text
+ * @brief called each frame. A change of the text rebuilds the blocks. When
+ * the text is a text_source_t, the text, its version and the range changed
+ * since the version held are read under one lock. Only the range is copied
+ * and only the blocks within it are rebuilt. Otherwise the hash of the
+ * text_data_t unit is compared and the text is copied when it differs.
+ */
+void uxdevice::textual_render_virtual_storage_t::synchronize_text(void) {
+  auto data = pipeline_memory_access<text_data_t>();
+  if (!data)
+    return;
+
+  if (std::holds_alternative<std::shared_ptr<text_source_t>>(data->value)) {
+    auto &ps = std::get<std::shared_ptr<text_source_t>>(data->value);
+    bool bsame_source = ps->id() == source_id && !blocks.empty();
+    if (bsame_source && ps->version() == source_version)
+      return;
+
+    ps->read_changes(source_version, [&](const std::string &s,
+                                         std::size_t version, bool brange,
+                                         std::size_t begin, std::size_t end) {
+      if (bsame_source && brange) {
+        std::size_t old_end = end + text.size() - s.size();
+        text.replace(begin, old_end - begin, s, begin, end - begin);
+        splice(begin, end, old_end);
+      } else {
+        text = s;
+        release_all();
+        blocks.clear();
+        split(0, text.size(), blocks);
+      }
+      source_version = version;
+    });
+
+    source_id = ps->id();
+    bposition = true;
+    return;
+  }
+
+  std::size_t hash = data->cached_hash_code();
+  if (source_id || hash != text_hash || blocks.empty()) {
+    data->read([&](const std::string_view &s) { text.assign(s); });
+    release_all();
+    blocks.clear();
+    split(0, text.size(), blocks);
+    source_id = 0;
+    text_hash = hash;
+    bposition = true;
+  }
+}
+
+/**
+ * @internal
+ * @fn split
+ * @param std::size_t begin
+ * @param std::size_t end
+ * @param std::vector<textual_block_t> &_blocks
+ * @brief gathers the lines of the range into blocks of block_line_limit lines.
+ * The line feed that ends a block is not part of it. A text ending with a line
+ * feed has a final empty line, as pango displays it.
+ */
+void uxdevice::textual_render_virtual_storage_t::split(
+    std::size_t begin, std::size_t end, std::vector<textual_block_t> &_blocks) {
+  std::size_t block_begin = begin;
+  std::size_t lines = {};
+  std::size_t cursor = begin;
+
+  while (true) {
+    std::size_t lf = text.find('\n', cursor);
+    if (lf == std::string::npos || lf >= end) {
+      _blocks.emplace_back(textual_block_t{block_begin, end, lines + 1});
+      break;
+    }
+
+    lines++;
+    if (lines == block_line_limit) {
+      _blocks.emplace_back(textual_block_t{block_begin, lf, lines});
+      block_begin = lf + 1;
+      lines = 0;
+    }
+    cursor = lf + 1;
+  }
+}
+
+/**
+ * @internal
+ * @fn splice
+ * @param std::size_t begin - start of the change within the current text.
+ * @param std::size_t end - end of the change within the current text.
+ * @param std::size_t old_end - end of the change within the prior text.
+ * @brief rebuilds the blocks touching the change. Blocks that begin after the
+ * change keep their layout and measurement, their offsets are shifted.
+ */
+void uxdevice::textual_render_virtual_storage_t::splice(std::size_t begin,
+                                                         std::size_t end,
+                                                         std::size_t old_end) {
+
+  auto first = std::lower_bound(
+      blocks.begin(), blocks.end(), begin,
+      [](const textual_block_t &b, std::size_t offset) {
+        return b.end < offset;
+      });
+  if (first == blocks.end())
+    first = std::prev(blocks.end());
+
+  auto last = std::upper_bound(
+      first, blocks.end(), old_end,
+      [](std::size_t offset, const textual_block_t &b) {
+        return offset < b.begin;
+      });
+
+  std::size_t split_begin = first->begin;
+  std::size_t split_end =
+      last == blocks.end() ? text.size() : last->begin - old_end + end - 1;
+
+  std::vector<textual_block_t> fresh = {};
+  split(split_begin, split_end, fresh);
+
+  for (auto it = first; it != last; it++)
+    release(*it);
+
+  for (auto it = last; it != blocks.end(); it++) {
+    it->begin = it->begin - old_end + end;
+    it->end = it->end - old_end + end;
+  }
+
+  std::size_t index = std::distance(blocks.begin(), first);
+  blocks.erase(first, last);
+  blocks.insert(blocks.begin() + index, fresh.begin(), fresh.end());
+
+  live_first = live_last = 0;
+}
+
+/**
+ * @internal
+ * @fn apply_template
+ * @param PangoLayout *block_layout
+ * @brief copies the paragraph settings of the template layout. The attribute
+ * list of the template covers the whole text and is not applied to blocks.
+ */
+void uxdevice::textual_render_virtual_storage_t::apply_template(
+    PangoLayout *block_layout) {
+  pango_layout_set_font_description(block_layout,
+                                    pango_layout_get_font_description(layout));
+  pango_layout_set_width(block_layout, pango_layout_get_width(layout));
+  pango_layout_set_wrap(block_layout, pango_layout_get_wrap(layout));
+  pango_layout_set_indent(block_layout, pango_layout_get_indent(layout));
+  pango_layout_set_spacing(block_layout, pango_layout_get_spacing(layout));
+  pango_layout_set_line_spacing(block_layout,
+                                pango_layout_get_line_spacing(layout));
+  pango_layout_set_alignment(block_layout, pango_layout_get_alignment(layout));
+  pango_layout_set_justify(block_layout, pango_layout_get_justify(layout));
+  pango_layout_set_ellipsize(block_layout, pango_layout_get_ellipsize(layout));
+
+  PangoTabArray *tabs = pango_layout_get_tabs(layout);
+  pango_layout_set_tabs(block_layout, tabs);
+  if (tabs)
+    pango_tab_array_free(tabs);
+}
+
+/**
+ * @internal
+ * @fn measure
+ * @param textual_block_t &block
+ * @brief lays out the block if it does not have a layout. The first
+ * measurement of a block refines the average line height used to estimate the
+ * blocks not yet laid out.
+ */
+void uxdevice::textual_render_virtual_storage_t::measure(
+    textual_block_t &block) {
+  if (!block.layout) {
+    block.layout = pango_layout_new(pango_layout_get_context(layout));
+    apply_template(block.layout);
+    pango_layout_set_text(block.layout, text.data() + block.begin,
+                          static_cast<int>(block.end - block.begin));
+  }
+
+  PangoRectangle logical_rect = {};
+  pango_layout_get_pixel_extents(block.layout, nullptr, &logical_rect);
+  double height = logical_rect.height;
+
+  if (!block.measured) {
+    block.measured = true;
+    measured_height += height;
+    measured_lines += block.lines;
+    line_height = measured_height / measured_lines;
+    bposition = true;
+  } else if (height != block.height) {
+    bposition = true;
+  }
+
+  block.height = height;
+}
+
+/// @brief frees the layout of the block. The measurement is kept.
+void uxdevice::textual_render_virtual_storage_t::release(
+    textual_block_t &block) {
+  if (block.layout) {
+    g_object_unref(block.layout);
+    block.layout = nullptr;
+  }
+}
+
+/// @brief frees the layouts of all blocks.
+void uxdevice::textual_render_virtual_storage_t::release_all(void) {
+  for (auto &block : blocks)
+    release(block);
+
+  live_first = live_last = 0;
+}
+
+/**
+ * @internal
+ * @fn position
+ * @brief computes the top of each block. Blocks not yet measured use the
+ * average line height.
+ */
+void uxdevice::textual_render_virtual_storage_t::position(void) {
+  double y = {};
+  for (auto &block : blocks) {
+    if (!block.measured)
+      block.height = block.lines * line_height;
+    block.y = y;
+    y += block.height;
+  }
+  total_height = y;
+  bposition = false;
+}
+
+/**
+ * @internal
+ * @fn draw
+ * @param cairo_t *cr
+ * @param coordinate_t *a
+ * @brief draws the blocks within the clip extents and the margin. The tops of
+ * the drawn blocks are recomputed as they are measured so that the visible
+ * text is placed exactly. Blocks leaving the area have their layouts freed.
+ */
+void uxdevice::textual_render_virtual_storage_t::draw(cairo_t *cr,
+                                                       coordinate_t *a) {
+  if (blocks.empty())
+    return;
+
+  if (bposition)
+    position();
+
+  double x1 = {}, y1 = {}, x2 = {}, y2 = {};
+  cairo_clip_extents(cr, &x1, &y1, &x2, &y2);
+  double top = y1 - a->y - margin;
+  double bottom = y2 - a->y + margin;
+
+  auto it = std::upper_bound(blocks.begin(), blocks.end(), top,
+                             [](double offset, const textual_block_t &b) {
+                               return offset < b.y + b.height;
+                             });
+  std::size_t first = std::distance(blocks.begin(), it);
+  std::size_t last = first;
+
+  double y = first < blocks.size() ? blocks[first].y : 0;
+  for (; last < blocks.size() && y < bottom; last++) {
+    textual_block_t &block = blocks[last];
+    block.y = y;
+    measure(block);
+    y += block.height;
+
+    pango_cairo_update_layout(cr, block.layout);
+    cairo_move_to(cr, a->x, a->y + block.y);
+
+    if (bpath_mode)
+      pango_cairo_layout_path(cr, block.layout);
+    else if (batlas_mode)
+      glyph_atlas_t::instance().show_layout(cr, block.layout);
+    else
+      pango_cairo_show_layout(cr, block.layout);
+  }
+
+  /** @brief free the layouts of blocks that were live but are no longer.*/
+  for (std::size_t i = live_first; i < live_last && i < blocks.size(); i++)
+    if (i < first || i >= last)
+      release(blocks[i]);
+  live_first = first;
+  live_last = last;
+}
+
+/**
+ * @internal
+ * @fn refine
+ * @brief measures a few blocks not yet laid out, wrapping around the text,
+ * to refine the estimates. Blocks outside the area drawn by the prior frame
+ * have their layouts freed again.
+ */
+void uxdevice::textual_render_virtual_storage_t::refine(void) {
+  for (std::size_t n = 0; n < refine_per_frame && n < blocks.size(); n++) {
+    refine_cursor = (refine_cursor + 1) % blocks.size();
+    textual_block_t &block = blocks[refine_cursor];
+    if (block.measured)
+      continue;
+
+    measure(block);
+    if (refine_cursor < live_first || refine_cursor >= live_last)
+      release(block);
+  }
+}
@@ -0,0 +1,139 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @author Anthony Matarazzo
+ * @file textual_render_virtual_storage.h
+ * @date 10/18/26
+ * @version 1.0
+ * @brief storage for the virtualized textual render.
+ */
+
+#pragma once
+
+namespace uxdevice {
+
+/**
+ * @internal
+ * @class textual_block_t
+ * @brief a run of whole lines of the text. The byte range excludes the final
+ * line feed. Until the block is laid out, its height is estimated from the
+ * line count. The layout is released when the block scrolls far from view.
+ */
+class textual_block_t {
+public:
+  std::size_t begin = {};
+  std::size_t end = {};
+  std::size_t lines = {};
+  double y = {};
+  double height = {};
+  bool measured = {};
+  PangoLayout *layout = {};
+};
+
+/**
+ * @class textual_render_virtual_storage_t
+ * @brief renders large text by splitting it into blocks of paragraphs. Only
+ * the blocks that intersect the clip area plus a margin are given a layout and
+ * drawn. The layout that receives the attribute units is used as a template
+ * for the paragraph settings. It is not given the text and is never measured
+ * as a whole. The text is copied from the text_data_t unit when it changes.
+ * When it is a text_source_t, only the changed range is copied and edits
+ * rebuild only the blocks within it.
+ */
+class textual_render_virtual_storage_t : virtual public hash_members_t,
+                                         virtual public system_error_t,
+                                         virtual public display_visual_t,
+                                         virtual public pipeline_memory_t {
+public:
+  textual_render_virtual_storage_t();
+
+  virtual ~textual_render_virtual_storage_t();
+
+  /// @brief move constructor
+  textual_render_virtual_storage_t(
+      textual_render_virtual_storage_t &&other) noexcept;
+
+  /// @brief copy constructor
+  textual_render_virtual_storage_t(
+      const textual_render_virtual_storage_t &other);
+
+  /// @brief copy assignment
+  textual_render_virtual_storage_t &
+  operator=(const textual_render_virtual_storage_t &other);
+
+  /// @brief move assignment
+  textual_render_virtual_storage_t &
+  operator=(textual_render_virtual_storage_t &&other) noexcept;
+
+  void pipeline_acquire(void);
+  bool pipeline_has_required_linkages(void);
+  std::size_t hash_code(void) const noexcept;
+
+  /// @brief linked attributes are part of the change detection.
+  std::size_t hash_generation(void) const noexcept;
+  bool hash_volatile(void) const noexcept;
+
+  PangoLayout *layout = nullptr;
+  guint layout_serial = {};
+
+  /// @brief lines gathered into one block and the pixels beyond the clip
+  /// area that are laid out ahead of scrolling.
+  std::size_t block_line_limit = 32;
+  double margin = 512.0;
+
+  /// @brief blocks laid out per frame outside of the visible area to refine
+  /// the estimated heights.
+  std::size_t refine_per_frame = 8;
+
+  /// @brief the text render unit in effect when the object was emitted.
+  bool bpath_mode = {};
+  bool batlas_mode = {};
+
+private:
+  void synchronize(void);
+  void synchronize_text(void);
+  void split(std::size_t begin, std::size_t end,
+             std::vector<textual_block_t> &blocks);
+  void splice(std::size_t begin, std::size_t end, std::size_t old_end);
+  void apply_template(PangoLayout *block_layout);
+  void measure(textual_block_t &block);
+  void release(textual_block_t &block);
+  void release_all(void);
+  void position(void);
+  void refine(void);
+  void draw(cairo_t *cr, coordinate_t *a);
+
+  std::vector<textual_block_t> blocks = {};
+  text_shaping_key_t paragraph_key = {};
+  std::string text = {};
+  std::size_t text_hash = {};
+  std::size_t source_id = {};
+  std::size_t source_version = {};
+
+  double line_height = {};
+  double measured_height = {};
+  std::size_t measured_lines = {};
+  double total_height = {};
+  bool bposition = {};
+  std::size_t refine_cursor = {};
+  std::size_t live_first = {};
+  std::size_t live_last = {};
+};
+} // namespace uxdevice
+UX_REGISTER_STD_HASH_SPECIALIZATION(uxdevice::textual_render_virtual_storage_t)
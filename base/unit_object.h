@@ -36,6 +36,12 @@
 #include <base/object/layer/system_error.h>
 #include <base/object/layer/hash_interface.h>
 
+/// @brief thread handoff utilities used by the message queue and context.
+#include <base/utility/mpsc_ring.h>
+#include <base/utility/wake_event.h>
+#include <base/utility/latency_histogram.h>
+#include <base/utility/event_reactor.h>
+
 #include <base/platform/keyboard.h>
 #include <base/platform/mouse.h>
 #include <base/platform/service.h>
@@ -54,6 +60,7 @@
 #include <base/utility/variant_visitor.h>
 
 #include <base/utility/cairo_function.h>
+#include <base/utility/unit_arena.h>
 
 #include <api/enums.h>
 #include <api/listeners.h>
@@ -66,8 +73,12 @@
 
 #include <base/object/layer/visitor_interface.h>
 
+#include <base/surface/hit_index.h>
 #include <base/surface/display_context.h>
 #include <base/surface/draw_buffer.h>
+#include <base/surface/font_description_intern.h>
+#include <base/surface/glyph_atlas.h>
+#include <base/surface/text_shaping_cache.h>
 #include <base/surface/brush/painter_brush.h>
 
 /// @brief object factories for declaring it in a compact form within the unit
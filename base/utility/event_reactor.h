@@ -0,0 +1,163 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+/**
+ * @author Anthony Matarazzo
+ * @file event_reactor.h
+ * @date 10/18/26
+ * @version 1.0
+ * @details single thread readiness loop over descriptors and a frame timer.
+ */
+
+namespace uxdevice {
+
+/**
+ * @class event_reactor_t
+ * @brief an epoll loop. Descriptors are watched for input and their function
+ * is called from the thread that runs the loop. A timerfd gives one shot
+ * wakes at an absolute steady clock time, used to pace frames. stop() may be
+ * called from any thread.
+ */
+class event_reactor_t {
+public:
+  event_reactor_t()
+      : epoll_fd(epoll_create1(EPOLL_CLOEXEC)),
+        timer_fd(timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK)) {
+    if (epoll_fd == -1 || timer_fd == -1) {
+      if (epoll_fd != -1)
+        close(epoll_fd);
+      if (timer_fd != -1)
+        close(timer_fd);
+      std::string serror = "event_reactor_t epoll or timerfd failed.";
+      throw std::runtime_error(serror);
+    }
+
+    watch(interrupt.native_handle(), [&]() { interrupt.consume(); });
+    watch(timer_fd, [&]() {
+      timer_consume();
+      if (fn_timer)
+        fn_timer();
+    });
+  }
+
+  ~event_reactor_t() {
+    close(timer_fd);
+    close(epoll_fd);
+  }
+
+  event_reactor_t(const event_reactor_t &other) = delete;
+  event_reactor_t &operator=(const event_reactor_t &other) = delete;
+
+  /**
+   * @fn watch
+   * @param int fd
+   * @param const std::function<void()> &fn
+   * @brief fn is called each time the descriptor has input. The input should
+   * be read within fn as the descriptor is level triggered.
+   */
+  void watch(int fd, const std::function<void()> &fn) {
+    epoll_event e = {};
+    e.events = EPOLLIN;
+    e.data.u32 = static_cast<std::uint32_t>(handlers.size());
+
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &e) == -1) {
+      std::string serror = "event_reactor_t epoll_ctl failed.";
+      throw std::runtime_error(serror);
+    }
+
+    handlers.emplace_back(fn);
+  }
+
+  /// @brief the function called when an armed time arrives.
+  void timer(const std::function<void()> &fn) { fn_timer = fn; }
+
+  /**
+   * @fn timer_arm
+   * @param const std::chrono::steady_clock::time_point &due
+   * @brief one shot. A time already passed fires on the next wait. The
+   * steady clock is CLOCK_MONOTONIC on linux.
+   */
+  void timer_arm(const std::chrono::steady_clock::time_point &due) noexcept {
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  due.time_since_epoch())
+                  .count();
+    itimerspec t = {};
+
+    /// @brief zero disarms the timer.
+    ns = std::max<decltype(ns)>(ns, 1);
+    t.it_value.tv_sec = static_cast<time_t>(ns / 1000000000);
+    t.it_value.tv_nsec = static_cast<long>(ns % 1000000000);
+    timerfd_settime(timer_fd, TFD_TIMER_ABSTIME, &t, nullptr);
+  }
+
+  void timer_disarm(void) noexcept {
+    itimerspec t = {};
+    timerfd_settime(timer_fd, 0, &t, nullptr);
+  }
+
+  /**
+   * @fn run
+   * @param const std::function<void()> &idle
+   * @brief dispatches until stop(). idle is called before each wait, which
+   * is the place to take input already read by a library from its
+   * descriptor and so not reported by epoll.
+   */
+  void run(const std::function<void()> &idle) {
+    std::array<epoll_event, 16> ready = {};
+    running = true;
+
+    while (running) {
+      if (idle)
+        idle();
+      if (!running)
+        break;
+
+      int n = epoll_wait(epoll_fd, ready.data(),
+                         static_cast<int>(ready.size()), -1);
+      if (n == -1 && errno == EINTR)
+        continue;
+      if (n == -1)
+        break;
+
+      for (int i = 0; i < n && running; i++)
+        handlers[ready[i].data.u32]();
+    }
+  }
+
+  void stop(void) noexcept {
+    running = false;
+    interrupt.signal();
+  }
+
+private:
+  void timer_consume(void) noexcept {
+    std::uint64_t expirations = {};
+    ssize_t ret = read(timer_fd, &expirations, sizeof(expirations));
+    (void)ret;
+  }
+
+  int epoll_fd = -1;
+  int timer_fd = -1;
+  wake_event_t interrupt = {};
+  std::atomic<bool> running = false;
+  std::vector<std::function<void()>> handlers = {};
+  std::function<void()> fn_timer = {};
+};
+
+} // namespace uxdevice
@@ -0,0 +1,89 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+/**
+ * @author Anthony Matarazzo
+ * @file latency_histogram.h
+ * @date 10/18/26
+ * @version 1.0
+ * @details counts of measured delays in power of two microsecond buckets.
+ */
+
+namespace uxdevice {
+
+/**
+ * @class latency_histogram_t
+ * @brief bucket 0 counts delays under two microseconds, bucket n counts
+ * delays from 2^n up to 2^(n+1) microseconds. The last bucket holds all
+ * longer ones. record() may be called from any thread.
+ */
+class latency_histogram_t {
+public:
+  static const std::size_t bucket_count = 32;
+
+  void record(const std::chrono::nanoseconds &d) noexcept {
+    auto us = static_cast<std::uint64_t>(
+        std::max<std::chrono::nanoseconds::rep>(d.count(), 0) / 1000);
+    std::size_t bucket = {};
+    while (us > 1 && bucket < bucket_count - 1) {
+      us >>= 1;
+      bucket++;
+    }
+    buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  std::size_t count(std::size_t bucket) const noexcept {
+    return buckets[bucket].load(std::memory_order_relaxed);
+  }
+
+  std::size_t total(void) const noexcept {
+    std::size_t n = {};
+    for (auto &b : buckets)
+      n += b.load(std::memory_order_relaxed);
+    return n;
+  }
+
+  /**
+   * @fn percentile
+   * @param double p - from 0 to 1.
+   * @brief the upper bound of the bucket holding the percentile.
+   */
+  std::chrono::microseconds percentile(double p) const noexcept {
+    std::size_t n = total();
+    std::size_t target = static_cast<std::size_t>(p * n);
+    std::size_t seen = {};
+
+    for (std::size_t i = 0; i < bucket_count; i++) {
+      seen += count(i);
+      if (seen > target || (seen == n && n))
+        return std::chrono::microseconds(std::uint64_t{2} << i);
+    }
+    return std::chrono::microseconds(0);
+  }
+
+  void clear(void) noexcept {
+    for (auto &b : buckets)
+      b.store(0, std::memory_order_relaxed);
+  }
+
+private:
+  std::array<std::atomic<std::size_t>, bucket_count> buckets = {};
+};
+
+} // namespace uxdevice
@@ -0,0 +1,131 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+/**
+ * @author Anthony Matarazzo
+ * @file mpsc_ring.h
+ * @date 10/18/26
+ * @version 1.0
+ * @details bounded lock free queue for many producer threads and one
+ * consumer.
+ */
+
+namespace uxdevice {
+
+/**
+ * @class mpsc_ring_t
+ * @brief a fixed ring of cells, each with a sequence number, after the
+ * bounded queue described by Dmitry Vyukov. Producers claim a position with a
+ * compare exchange on the tail and publish the cell by advancing its sequence.
+ * The single consumer reads the head without contention. A push fails rather
+ * than blocks when the ring is full so the producer can choose a fallback.
+ *
+ * @tparam T - trivially copyable item.
+ * @tparam N - capacity, a power of two.
+ */
+template <typename T, std::size_t N> class mpsc_ring_t {
+  static_assert(N >= 2 && (N & (N - 1)) == 0,
+                "mpsc_ring_t capacity must be a power of two.");
+  static_assert(std::is_trivially_copyable<T>::value,
+                "mpsc_ring_t items must be trivially copyable.");
+
+public:
+  mpsc_ring_t() {
+    for (std::size_t i = 0; i < N; i++)
+      cells[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  mpsc_ring_t(const mpsc_ring_t &other) = delete;
+  mpsc_ring_t &operator=(const mpsc_ring_t &other) = delete;
+
+  /**
+   * @fn push
+   * @param const T &item
+   * @brief called from any thread.
+   * @return bool - false if the ring is full.
+   */
+  bool push(const T &item) noexcept {
+    std::size_t pos = tail.load(std::memory_order_relaxed);
+    cell_t *cell = {};
+
+    while (true) {
+      cell = &cells[pos & (N - 1)];
+      std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      std::intptr_t dif =
+          static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+
+      if (dif == 0) {
+        if (tail.compare_exchange_weak(pos, pos + 1,
+                                       std::memory_order_relaxed))
+          break;
+      } else if (dif < 0) {
+        return false;
+      } else {
+        pos = tail.load(std::memory_order_relaxed);
+      }
+    }
+
+    cell->data = item;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @fn pop
+   * @param T &item
+   * @brief called only from the consumer thread.
+   * @return bool - false if the ring is empty or the next item is not yet
+   * published.
+   */
+  bool pop(T &item) noexcept {
+    std::size_t pos = head.load(std::memory_order_relaxed);
+    cell_t *cell = &cells[pos & (N - 1)];
+    std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+
+    if (sequence != pos + 1)
+      return false;
+
+    item = cell->data;
+    cell->sequence.store(pos + N, std::memory_order_release);
+    head.store(pos + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /// @brief approximate when called while producers are active.
+  bool empty(void) const noexcept {
+    std::size_t pos = head.load(std::memory_order_relaxed);
+    return cells[pos & (N - 1)].sequence.load(std::memory_order_acquire) !=
+           pos + 1;
+  }
+
+private:
+  class cell_t {
+  public:
+    std::atomic<std::size_t> sequence = {};
+    T data = {};
+  };
+
+  /** @brief the producer tail and the consumer head are kept on separate
+   * cache lines.*/
+  alignas(64) std::array<cell_t, N> cells = {};
+  alignas(64) std::atomic<std::size_t> tail = {};
+  alignas(64) std::atomic<std::size_t> head = {};
+};
+
+} // namespace uxdevice
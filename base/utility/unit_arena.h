@@ -0,0 +1,126 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+/**
+ * @author Anthony Matarazzo
+ * @file unit_arena.h
+ * @date 10/18/26
+ * @version 1.0
+ * @details per surface memory pool for display units and their shared
+ * pointer control blocks.
+ */
+
+namespace uxdevice {
+
+/**
+ * @class unit_arena_t
+ * @brief a pooled memory resource owned by a surface. Units are created on
+ * the client thread yet may be released on the render thread when the
+ * pipeline drops them, so the synchronized pool is used. Allocations are
+ * counted so that release() can return the pools at once when every unit is
+ * gone. An arena whose units outlive the epoch is replaced by its owner and
+ * its pools are returned by the destructor after the last unit is released,
+ * as each unit's allocator holds the arena.
+ */
+class unit_arena_t : public std::pmr::memory_resource {
+public:
+  unit_arena_t() : pool(std::pmr::new_delete_resource()) {}
+
+  unit_arena_t(const unit_arena_t &other) = delete;
+  unit_arena_t &operator=(const unit_arena_t &other) = delete;
+
+  /**
+   * @fn release
+   * @brief return all pooled memory at once. called from surface clear on
+   * the client thread, which is the only thread that allocates.
+   * @return bool - false if units remain referenced and memory was kept. The
+   * caller then ends the epoch by allocating from a new arena.
+   */
+  bool release(void) {
+    if (outstanding.load(std::memory_order_acquire) != 0)
+      return false;
+    pool.release();
+    return true;
+  }
+
+  std::size_t allocations(void) const {
+    return outstanding.load(std::memory_order_relaxed);
+  }
+
+private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    void *p = pool.allocate(bytes, alignment);
+    outstanding.fetch_add(1, std::memory_order_relaxed);
+    return p;
+  }
+
+  void do_deallocate(void *p, std::size_t bytes,
+                     std::size_t alignment) override {
+    pool.deallocate(p, bytes, alignment);
+    outstanding.fetch_sub(1, std::memory_order_release);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource &other) const
+      noexcept override {
+    return this == &other;
+  }
+
+  std::pmr::synchronized_pool_resource pool;
+  std::atomic<std::size_t> outstanding = 0;
+};
+
+/**
+ * @class unit_allocator_t
+ * @brief allocator given to std::allocate_shared. The object and its control
+ * block come from one arena block. The allocator holds a shared pointer to
+ * the arena so that units kept by the caller after the surface is gone still
+ * have their memory resource.
+ */
+template <typename T> class unit_allocator_t {
+public:
+  typedef T value_type;
+
+  explicit unit_allocator_t(std::shared_ptr<unit_arena_t> _arena)
+      : arena(std::move(_arena)) {}
+
+  template <typename U>
+  unit_allocator_t(const unit_allocator_t<U> &other) : arena(other.arena) {}
+
+  T *allocate(std::size_t n) {
+    return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T *p, std::size_t n) {
+    arena->deallocate(p, n * sizeof(T), alignof(T));
+  }
+
+  template <typename U>
+  bool operator==(const unit_allocator_t<U> &other) const {
+    return arena == other.arena;
+  }
+
+  template <typename U>
+  bool operator!=(const unit_allocator_t<U> &other) const {
+    return arena != other.arena;
+  }
+
+  std::shared_ptr<unit_arena_t> arena = {};
+};
+
+} // namespace uxdevice
@@ -0,0 +1,119 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+/**
+ * @author Anthony Matarazzo
+ * @file wake_event.h
+ * @date 10/18/26
+ * @version 1.0
+ * @details wake signal between threads that keeps a count rather than a
+ * condition.
+ */
+
+namespace uxdevice {
+
+/**
+ * @class wake_event_t
+ * @brief an eventfd counter. signal() adds to the count and a waiting thread
+ * returns while the count is above zero, resetting it. A signal given before
+ * the wait begins is therefore never lost, unlike a condition variable
+ * notified without a predicate. The descriptor may also be watched by poll
+ * or epoll through native_handle().
+ */
+class wake_event_t {
+public:
+  wake_event_t() : fd(eventfd(0, EFD_CLOEXEC)) {
+    if (fd == -1) {
+      std::string serror = "wake_event_t eventfd failed.";
+      throw std::runtime_error(serror);
+    }
+  }
+
+  ~wake_event_t() {
+    if (fd != -1)
+      close(fd);
+  }
+
+  wake_event_t(const wake_event_t &other) = delete;
+  wake_event_t &operator=(const wake_event_t &other) = delete;
+
+  /// @brief called from any thread.
+  void signal(void) noexcept {
+    std::uint64_t one = 1;
+    ssize_t ret = write(fd, &one, sizeof(one));
+    (void)ret;
+  }
+
+  /// @brief waits for a signal.
+  void wait(void) noexcept { wait_ms(-1); }
+
+  /**
+   * @fn wait_until
+   * @param const std::chrono::steady_clock::time_point &due
+   * @brief waits for a signal or the time.
+   * @return bool - true if signalled.
+   */
+  bool wait_until(const std::chrono::steady_clock::time_point &due) noexcept {
+    auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+        due - std::chrono::steady_clock::now());
+    return wait_ms(static_cast<int>(
+        std::max<std::chrono::milliseconds::rep>(remaining.count() + 1, 0)));
+  }
+
+  /**
+   * @fn wait_ms
+   * @param int timeout - milliseconds, -1 waits indefinitely.
+   * @brief the count is read, which resets it, when signalled.
+   * @return bool - true if signalled.
+   */
+  bool wait_ms(int timeout) noexcept {
+    pollfd p = {fd, POLLIN, 0};
+    int ret = {};
+
+    do
+      ret = poll(&p, 1, timeout);
+    while (ret == -1 && errno == EINTR);
+
+    if (ret <= 0)
+      return false;
+
+    consume();
+    return true;
+  }
+
+  /// @brief resets the count without waiting, used after epoll reports it.
+  void consume(void) noexcept {
+    std::uint64_t count = {};
+    ssize_t ret = read(fd, &count, sizeof(count));
+    (void)ret;
+  }
+
+  /// @brief a signal is waiting to be consumed. Does not reset the count.
+  bool pending(void) const noexcept {
+    pollfd p = {fd, POLLIN, 0};
+    return poll(&p, 1, 0) == 1;
+  }
+
+  int native_handle(void) const noexcept { return fd; }
+
+private:
+  int fd = -1;
+};
+
+} // namespace uxdevice
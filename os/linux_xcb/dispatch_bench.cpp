@@ -0,0 +1,133 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @author Anthony Matarazzo
+ * @file dispatch_bench.cpp
+ * @date 10/18/26
+ * @version 1.0
+ * @brief replays a recorded mix of xcb events through the two dispatch
+ * lookups, the std::unordered_map of std::function that fn_visit_dispatch
+ * used and the function pointer table it uses now.
+ * @details standalone program, not part of the library. No server is
+ * needed. Build it with the library sources, for example
+ *
+ *   g++ -std=c++17 -O2 -I. os/linux_xcb/dispatch_bench.cpp <library
+ *   objects> $(pkg-config --cflags --libs pangocairo xcb xcb-shm
+ *   xcb-keysyms x11-xcb librsvg-2.0)
+ *
+ * and run as dispatch_bench [events] [passes]. The handlers only count, so
+ * the lookup and call are measured. Both paths still build the device and
+ * its message variant per event in the library, which is not part of this
+ * measurement.
+ */
+// clang-format off
+
+#include <base/unit_object.h>
+
+// clang-format on
+
+namespace {
+
+std::array<std::size_t, 128> handled = {};
+
+template <int CODE> void count_fn(void *, xcb_generic_event_t *) {
+  handled[CODE]++;
+}
+
+using dispatch_fn_t = void (*)(void *, xcb_generic_event_t *);
+
+constexpr std::array<dispatch_fn_t, 128> dispatch_table(void) {
+  std::array<dispatch_fn_t, 128> t = {};
+  t[XCB_KEY_PRESS] = &count_fn<XCB_KEY_PRESS>;
+  t[XCB_KEY_RELEASE] = &count_fn<XCB_KEY_RELEASE>;
+  t[XCB_MAPPING_NOTIFY] = &count_fn<XCB_MAPPING_NOTIFY>;
+  t[XCB_BUTTON_PRESS] = &count_fn<XCB_BUTTON_PRESS>;
+  t[XCB_BUTTON_RELEASE] = &count_fn<XCB_BUTTON_RELEASE>;
+  t[XCB_MOTION_NOTIFY] = &count_fn<XCB_MOTION_NOTIFY>;
+  t[XCB_EXPOSE] = &count_fn<XCB_EXPOSE>;
+  t[XCB_CONFIGURE_NOTIFY] = &count_fn<XCB_CONFIGURE_NOTIFY>;
+  t[XCB_CLIENT_MESSAGE] = &count_fn<XCB_CLIENT_MESSAGE>;
+  return t;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t events =
+      argc > 1 ? static_cast<std::size_t>(std::max(std::atoi(argv[1]), 1))
+               : 100000;
+  const int passes = argc > 2 ? std::max(std::atoi(argv[2]), 1) : 100;
+
+  /// @brief a pointer heavy session with typing, exposes and events that
+  /// are not handled, some sent by other clients.
+  const std::array<std::uint8_t, 16> mix = {
+      XCB_MOTION_NOTIFY,  XCB_MOTION_NOTIFY, XCB_MOTION_NOTIFY,
+      XCB_MOTION_NOTIFY,  XCB_MOTION_NOTIFY, XCB_BUTTON_PRESS,
+      XCB_BUTTON_RELEASE, XCB_KEY_PRESS,     XCB_KEY_RELEASE,
+      XCB_EXPOSE,         XCB_EXPOSE,        XCB_CONFIGURE_NOTIFY,
+      XCB_ENTER_NOTIFY,   XCB_FOCUS_IN,      XCB_PROPERTY_NOTIFY,
+      XCB_CLIENT_MESSAGE | 0x80};
+
+  std::vector<xcb_generic_event_t> recorded(events);
+  std::minstd_rand random(1);
+  for (auto &e : recorded)
+    e.response_type = mix[random() % mix.size()];
+
+  auto measure = [&](const char *name, auto dispatch) {
+    handled = {};
+    auto start = std::chrono::steady_clock::now();
+
+    for (int p = 0; p < passes; p++)
+      for (auto &e : recorded)
+        dispatch(&e);
+
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    std::size_t total = std::accumulate(handled.begin(), handled.end(),
+                                        static_cast<std::size_t>(0));
+    double count = static_cast<double>(passes) * events;
+
+    std::cout << name << ": " << count / elapsed.count() << " events/s, "
+              << elapsed.count() * 1e9 / count << " ns/event (" << total
+              << " handled)" << std::endl;
+  };
+
+  std::unordered_map<std::size_t, std::function<void(xcb_generic_event_t *)>>
+      map = {};
+  for (int code = 0; code < 128; code++)
+    if (dispatch_table()[code]) {
+      auto fn = dispatch_table()[code];
+      map[code] = [fn](xcb_generic_event_t *e) { fn(nullptr, e); };
+    }
+
+  measure("std::unordered_map<std::function>", [&](xcb_generic_event_t *e) {
+    auto it = map.find(e->response_type & ~0x80);
+    if (it != map.end())
+      it->second(e);
+  });
+
+  static constexpr std::array<dispatch_fn_t, 128> table = dispatch_table();
+  measure("function pointer table", [&](xcb_generic_event_t *e) {
+    auto fn = table[e->response_type & ~0x80];
+    if (fn)
+      fn(nullptr, e);
+  });
+
+  return 0;
+}
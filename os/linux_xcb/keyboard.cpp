@@ -44,34 +44,129 @@
 // clang-format on
 
 /**
- * @fn  keyboard_device_event_t()
- * @brief constructor implementation
- *
+ * @internal
+ * @fn attach
+ * @param xcb_connection_t *connection
+ * @param Display *_xdisplay
+ * @brief allocates the key symbol tables of the connection.
  */
-uxdevice::keyboard_device_xcb_t::keyboard_device_xcb_t()
-    : keyboard_device_base_t() {
+void uxdevice::keysym_cache_t::attach(xcb_connection_t *connection,
+                                      Display *_xdisplay) {
+  detach();
 
-  syms = xcb_key_symbols_alloc(window_manager->connection);
+  syms = xcb_key_symbols_alloc(connection);
   if (!syms) {
     std::stringstream sError;
     sError << "xcb_key_symbols_alloc "
            << "  " << __FILE__ << " " << __func__;
     throw std::runtime_error(sError.str());
   }
+
+  xdisplay = _xdisplay;
 }
 
 /**
- * @fn  ~keyboard_device_event_t()
- * @brief
- *
+ * @internal
+ * @fn detach
+ * @brief frees the key symbol tables, called before the display closes.
  */
-uxdevice::keyboard_device_xcb_t::~keyboard_device_xcb_t() {
+void uxdevice::keysym_cache_t::detach(void) {
   if (syms) {
     xcb_key_symbols_free(syms);
     syms = nullptr;
   }
+
+  xdisplay = nullptr;
+  entries.clear();
+}
+
+/**
+ * @internal
+ * @fn translate
+ * @param xcb_key_press_event_t *xcb - a press or release.
+ * @brief the keysym is the unshifted symbol of the key. Keys below 0x99 are
+ * given to XLookupString for their text under the modifier state.
+ * @return keysym_translation_t
+ */
+uxdevice::keysym_translation_t
+uxdevice::keysym_cache_t::translate(xcb_key_press_event_t *xcb) {
+  std::uint32_t key = (static_cast<std::uint32_t>(xcb->detail) << 16) |
+                      (xcb->state & state_mask);
+
+  auto it = entries.find(key);
+  if (it != entries.end())
+    return it->second;
+
+  keysym_translation_t t = {};
+  if (!syms)
+    return t;
+
+  t.sym = xcb_key_press_lookup_keysym(syms, xcb, 0);
+
+  // in range of keys?
+  if (t.sym < 0x99) {
+
+    // use xwindows to lookup the string
+    XKeyEvent keyEvent = {};
+    keyEvent.type = KeyPress;
+    keyEvent.display = xdisplay;
+    keyEvent.keycode = xcb->detail;
+    keyEvent.state = xcb->state & state_mask;
+    keyEvent.root = xcb->root;
+    keyEvent.time = xcb->time;
+    keyEvent.window = xcb->event;
+    keyEvent.serial = xcb->sequence;
+
+    t.length = XLookupString(&keyEvent, t.c.data(), t.c.size(), nullptr,
+                             nullptr);
+  }
+
+  entries.emplace(key, t);
+  return t;
+}
+
+/**
+ * @internal
+ * @fn mapping_notify
+ * @param xcb_mapping_notify_event_t *xcb
+ * @brief the keyboard mapping changed. The xcb tables and those of Xlib,
+ * which does not see events read through xcb, are refreshed and the
+ * translations are dropped.
+ */
+void uxdevice::keysym_cache_t::mapping_notify(
+    xcb_mapping_notify_event_t *xcb) {
+  if (syms)
+    xcb_refresh_keyboard_mapping(syms, xcb);
+
+  if (xdisplay) {
+    XMappingEvent m = {};
+    m.type = MappingNotify;
+    m.display = xdisplay;
+    m.serial = xcb->sequence;
+    m.request = xcb->request;
+    m.first_keycode = xcb->first_keycode;
+    m.count = xcb->count;
+    XRefreshKeyboardMapping(&m);
+  }
+
+  entries.clear();
 }
 
+/**
+ * @fn  keyboard_device_event_t()
+ * @brief constructor implementation
+ *
+ */
+uxdevice::keyboard_device_xcb_t::keyboard_device_xcb_t()
+    : keyboard_device_base_t() {}
+
+/**
+ * @fn  ~keyboard_device_event_t()
+ * @brief
+ *
+ */
+uxdevice::keyboard_device_xcb_t::~keyboard_device_xcb_t() {}
+
 /**
  * @fn uxdevice::event_t get(void)
  * @brief
@@ -87,28 +182,23 @@ uxdevice::keyboard_device_xcb_t *uxdevice::keyboard_device_xcb_t::get(void) {
        * @param xcb_configure_notify_event_t *xcb
        */
       [&](key_press_xcb_t xcb) {
-        // get key symbol
-        sym = xcb_key_press_lookup_keysym(syms, xcb.get(), 0);
+        if (!keysyms)
+          return;
+
+        // key symbol and string, looked up once for each state.
+        auto t = keysyms->translate(xcb.get());
+        sym = t.sym;
+        c = t.c;
 
         // in range of keys?
         if (sym < 0x99) {
 
-          // use xwindows to lookup the string
-          XKeyEvent keyEvent;
-          keyEvent.display = window_manager->xdisplay;
-          keyEvent.keycode = xcb->detail;
-          keyEvent.state = xcb->state;
-          keyEvent.root = xcb->root;
-          keyEvent.time = xcb->time;
-          keyEvent.window = xcb->event;
-          keyEvent.serial = xcb->sequence;
-
           // filter as a keypress event
-          if (XLookupString(&keyEvent, c.data(), c.size(), nullptr, nullptr)) {
-            alias = std::type_index{typeid(listen_keypress_t)};
+          if (t.length) {
+            alias = event_id_t::keypress;
           } else {
             // send a keydown event
-            alias = std::type_index{typeid(listen_keydown_t)};
+            alias = event_id_t::keydown;
           }
         }
       },
@@ -119,12 +209,15 @@ uxdevice::keyboard_device_xcb_t *uxdevice::keyboard_device_xcb_t::get(void) {
        * @param xcb_configure_notify_event_t *xcb
        */
       [&](key_release_xcb_t xcb) {
-        sym = xcb_key_press_lookup_keysym(syms, xcb.get(), 0);
-        alias = std::type_index{typeid(listen_keyup_t)};
+        if (!keysyms)
+          return;
+
+        sym = keysyms->translate(xcb.get()).sym;
+        alias = event_id_t::keyup;
       },
       [&](std::monostate) {
         sym = {};
-        alias = std::type_index{typeid(std::monostate)};
+        alias = event_id_t::none;
       }};
   std::visit(visit_map, data);
   return this;
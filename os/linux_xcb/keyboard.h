@@ -28,6 +28,52 @@
 namespace uxdevice {
 class os_xcb_linux_t;
 
+/**
+ * @internal
+ * @class keysym_translation_t
+ * @brief the keysym of a key and the text XLookupString gives for it under
+ * one modifier state. length is zero when the key gives no text.
+ */
+class keysym_translation_t {
+public:
+  std::uint32_t sym = {};
+  std::array<char, 16> c = {};
+  int length = {};
+};
+
+/**
+ * @internal
+ * @class keysym_cache_t
+ * @brief translations of key events keyed by keycode and modifier state.
+ * Entries are filled at the first press of each combination so that key
+ * repeat does not call through Xlib. The window manager owns one per
+ * connection and clears it on MappingNotify. It is used from the thread
+ * dispatching events only.
+ */
+class keysym_cache_t {
+public:
+  keysym_cache_t() {}
+  ~keysym_cache_t() { detach(); }
+
+  keysym_cache_t(const keysym_cache_t &other) = delete;
+  keysym_cache_t &operator=(const keysym_cache_t &other) = delete;
+
+  void attach(xcb_connection_t *connection, Display *_xdisplay);
+  void detach(void);
+
+  keysym_translation_t translate(xcb_key_press_event_t *xcb);
+  void mapping_notify(xcb_mapping_notify_event_t *xcb);
+
+  /// @brief the modifier and keyboard group bits of the state. Pointer
+  /// button bits do not change the translation.
+  static const std::uint16_t state_mask = 0x60ff;
+
+private:
+  xcb_key_symbols_t *syms = {};
+  Display *xdisplay = {};
+  std::unordered_map<std::uint32_t, keysym_translation_t> entries = {};
+};
+
 // @brief pointer wrappers
 class key_press_xcb_t : public ptr_type_class_alias<xcb_key_press_event_t *> {};
 
@@ -58,6 +104,9 @@ public:
   keyboard_device_xcb_t();
   keyboard_device_xcb_t(typename keyboard_event_xcb_t::data_storage_t _msg)
       : keyboard_device_base_t(_msg) {}
+  keyboard_device_xcb_t(keysym_cache_t *_keysyms,
+                        typename keyboard_event_xcb_t::data_storage_t _msg)
+      : keyboard_device_base_t(_msg), keysyms(_keysyms) {}
 
   ~keyboard_device_xcb_t();
   void initialize();
@@ -65,22 +114,24 @@ public:
   /// @brief copy assignment operator
   keyboard_device_xcb_t &operator=(const keyboard_device_xcb_t &other) {
     keyboard_device_base_t::operator=(other);
+    keysyms = other.keysyms;
     return *this;
   }
 
   /// @brief move assignment
   keyboard_device_xcb_t &operator=(keyboard_device_xcb_t &&other) noexcept {
     keyboard_device_base_t::operator=(other);
+    keysyms = other.keysyms;
     return *this;
   }
 
   /// @brief move constructor
   keyboard_device_xcb_t(keyboard_device_xcb_t &&other) noexcept
-      : keyboard_device_base_t(other) {}
+      : keyboard_device_base_t(other), keysyms(other.keysyms) {}
 
   /// @brief copy constructor
   keyboard_device_xcb_t(const keyboard_device_xcb_t &other)
-      : keyboard_device_base_t(other) {}
+      : keyboard_device_base_t(other), keysyms(other.keysyms) {}
 
   /**@brief must specialize this for interface.
    * interface abstract returns the visitor map. see the
@@ -88,8 +139,8 @@ public:
   keyboard_device_xcb_t *get(void);
 
 private:
-  xcb_key_symbols_t *syms = {};
-  std::shared_ptr<os_xcb_linux_t> window_manager = {};
+  /// @brief the translations of the window manager.
+  keysym_cache_t *keysyms = {};
 };
 
 using os_keyboard_device_t = keyboard_device_xcb_t;
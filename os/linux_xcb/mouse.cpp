@@ -65,7 +65,7 @@ uxdevice::mouse_device_xcb_t *uxdevice::mouse_device_xcb_t::get(void) {
       [&](motion_notify_xcb_t xcb) {
         x = xcb->event_x;
         y = xcb->event_y;
-        alias = std::type_index{typeid(listen_mousemove_t)};
+        alias = event_id_t::mousemove;
       },
 
       /**
@@ -84,10 +84,10 @@ uxdevice::mouse_device_xcb_t *uxdevice::mouse_device_xcb_t::get(void) {
         if (xcb->detail == XCB_BUTTON_INDEX_4 ||
             xcb->detail == XCB_BUTTON_INDEX_5) {
           d = xcb->detail == XCB_BUTTON_INDEX_4 ? 1 : -1;
-          alias = std::type_index{typeid(listen_wheel_t)};
+          alias = event_id_t::wheel;
         } else {
           d = xcb->detail;
-          alias = std::type_index{typeid(listen_mousedown_t)};
+          alias = event_id_t::mousedown;
         }
       },
 
@@ -100,11 +100,11 @@ uxdevice::mouse_device_xcb_t *uxdevice::mouse_device_xcb_t::get(void) {
         // ignore button 4 and 5 which are wheel events.
         if (xcb->detail != XCB_BUTTON_INDEX_4 &&
             xcb->detail != XCB_BUTTON_INDEX_5)
-          alias = std::type_index{typeid(listen_mouseup_t)};
+          alias = event_id_t::mouseup;
         else
-          alias = std::type_index{typeid(mouse_device_xcb_t)};
+          alias = event_id_t::none;
       },
-      [&](std::monostate) { alias = std::type_index{typeid(std::monostate)}; }};
+      [&](std::monostate) { alias = event_id_t::none; }};
 
   std::visit(visit_map, data);
   return this;
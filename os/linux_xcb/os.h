@@ -38,4 +38,5 @@
 #include <X11/keysymdef.h>
 
 #include <sys/types.h>
+#include <xcb/shm.h>
 #include <xcb/xcb_keysyms.h>
@@ -0,0 +1,186 @@
+/*
+ * This file is part of the ux_gui_stream distribution
+ * (https://github.com/amatarazzo777/ux_gui_stream).
+ * Copyright (c) 2020 Anthony Matarazzo.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @author Anthony Matarazzo
+ * @file present_bench.cpp
+ * @date 10/18/26
+ * @version 1.0
+ * @brief frame present rate of the client memory paths of os_xcb_linux_t,
+ * xcb_shm_put_image waiting for its completion event against xcb_put_image.
+ * @details standalone program, not part of the library. It issues the same
+ * requests as fn_present_surface on a window of its own. Build and run it
+ * under a virtual server, for example
+ *
+ *   g++ -std=c++17 -O2 -I. os/linux_xcb/present_bench.cpp <library
+ *   objects> $(pkg-config --cflags --libs pangocairo xcb xcb-shm
+ *   xcb-keysyms x11-xcb librsvg-2.0)
+ *   Xvfb :99 -screen 0 1920x1080x24 &
+ *   DISPLAY=:99 ./present_bench [frames] [width] [height]
+ *
+ * Each frame draws into the image surface, then presents all of it. The
+ * shared memory frame waits for the completion of the prior present before
+ * drawing, as fn_acquire_surface does.
+ */
+// clang-format off
+
+#include <base/unit_object.h>
+
+// clang-format on
+
+int main(int argc, char **argv) {
+  const int frames = argc > 1 ? std::max(std::atoi(argv[1]), 1) : 300;
+  const int width = argc > 2 ? std::max(std::atoi(argv[2]), 1) : 1920;
+  const int height = argc > 3 ? std::max(std::atoi(argv[3]), 1) : 1080;
+
+  xcb_connection_t *connection = xcb_connect(nullptr, nullptr);
+  if (xcb_connection_has_error(connection)) {
+    std::cerr << "no X server, set DISPLAY." << std::endl;
+    return 1;
+  }
+
+  xcb_screen_t *screen =
+      xcb_setup_roots_iterator(xcb_get_setup(connection)).data;
+  if (screen->root_depth != 24 && screen->root_depth != 32) {
+    std::cerr << "a 24 or 32 bit screen is required." << std::endl;
+    return 1;
+  }
+
+  xcb_window_t window = xcb_generate_id(connection);
+  std::uint32_t window_values[] = {screen->black_pixel};
+  xcb_create_window(connection, XCB_COPY_FROM_PARENT, window, screen->root, 0,
+                    0, static_cast<std::uint16_t>(width),
+                    static_cast<std::uint16_t>(height), 0,
+                    XCB_WINDOW_CLASS_INPUT_OUTPUT, screen->root_visual,
+                    XCB_CW_BACK_PIXEL, window_values);
+  xcb_map_window(connection, window);
+
+  xcb_gcontext_t graphics = xcb_generate_id(connection);
+  std::uint32_t gc_values[] = {screen->black_pixel, 0};
+  xcb_create_gc(connection, graphics, window,
+                XCB_GC_FOREGROUND | XCB_GC_GRAPHICS_EXPOSURES, gc_values);
+  xcb_flush(connection);
+
+  int stride = cairo_format_stride_for_width(CAIRO_FORMAT_RGB24, width);
+
+  auto draw = [&](cairo_surface_t *s, int f) {
+    cairo_t *cr = cairo_create(s);
+    cairo_set_source_rgb(cr, (f % 256) / 255.0, 0.25, 0.5);
+    cairo_paint(cr);
+    cairo_destroy(cr);
+    cairo_surface_flush(s);
+  };
+
+  auto report = [&](const char *name, std::chrono::duration<double> elapsed) {
+    std::cout << name << ": " << frames / elapsed.count() << " frames/s, "
+              << elapsed.count() * 1000.0 / frames << " ms/frame" << std::endl;
+  };
+
+  // put_image, the pixels travel in the requests.
+  {
+    cairo_surface_t *s =
+        cairo_image_surface_create(CAIRO_FORMAT_RGB24, width, height);
+    unsigned char *data = cairo_image_surface_get_data(s);
+    std::size_t max_bytes =
+        static_cast<std::size_t>(xcb_get_maximum_request_length(connection)) *
+            4 -
+        sizeof(xcb_put_image_request_t);
+    int rows = std::max(1, static_cast<int>(max_bytes / stride));
+
+    auto start = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; f++) {
+      draw(s, f);
+      for (int row = 0; row < height; row += rows) {
+        int count = std::min(rows, height - row);
+        xcb_put_image(connection, XCB_IMAGE_FORMAT_Z_PIXMAP, window, graphics,
+                      static_cast<std::uint16_t>(width),
+                      static_cast<std::uint16_t>(count), 0,
+                      static_cast<std::int16_t>(row), 0, screen->root_depth,
+                      static_cast<std::uint32_t>(count * stride),
+                      data + row * stride);
+      }
+      xcb_flush(connection);
+    }
+    free(xcb_get_input_focus_reply(connection,
+                                   xcb_get_input_focus(connection), nullptr));
+    report("xcb_put_image", std::chrono::steady_clock::now() - start);
+    cairo_surface_destroy(s);
+  }
+
+  // shared memory, each frame waits for the completion of the prior one.
+  const xcb_query_extension_reply_t *ext =
+      xcb_get_extension_data(connection, &xcb_shm_id);
+  int shmid = ext && ext->present
+                  ? shmget(IPC_PRIVATE,
+                           static_cast<std::size_t>(stride) * height,
+                           IPC_CREAT | 0600)
+                  : -1;
+  void *addr = shmid == -1 ? nullptr : shmat(shmid, nullptr, 0);
+
+  if (addr && addr != reinterpret_cast<void *>(-1)) {
+    xcb_shm_seg_t seg = xcb_generate_id(connection);
+    xcb_generic_error_t *error = xcb_request_check(
+        connection, xcb_shm_attach_checked(connection, seg, shmid, 0));
+    shmctl(shmid, IPC_RMID, nullptr);
+
+    if (!error) {
+      cairo_surface_t *s = cairo_image_surface_create_for_data(
+          static_cast<unsigned char *>(addr), CAIRO_FORMAT_RGB24, width,
+          height, stride);
+      std::uint8_t completion =
+          static_cast<std::uint8_t>(ext->first_event + XCB_SHM_COMPLETION);
+      bool pending = false;
+
+      auto start = std::chrono::steady_clock::now();
+      for (int f = 0; f < frames; f++) {
+        while (pending) {
+          xcb_generic_event_t *e = xcb_wait_for_event(connection);
+          if (!e)
+            break;
+          pending = (e->response_type & ~0x80) != completion;
+          free(e);
+        }
+
+        draw(s, f);
+        xcb_shm_put_image(connection, window, graphics,
+                          static_cast<std::uint16_t>(width),
+                          static_cast<std::uint16_t>(height), 0, 0,
+                          static_cast<std::uint16_t>(width),
+                          static_cast<std::uint16_t>(height), 0, 0,
+                          screen->root_depth, XCB_IMAGE_FORMAT_Z_PIXMAP, 1,
+                          seg, 0);
+        xcb_flush(connection);
+        pending = true;
+      }
+      report("xcb_shm_put_image", std::chrono::steady_clock::now() - start);
+
+      cairo_surface_destroy(s);
+      xcb_shm_detach(connection, seg);
+    } else {
+      free(error);
+      std::cerr << "MIT-SHM attach failed, the server is not local."
+                << std::endl;
+    }
+    shmdt(addr);
+  } else {
+    std::cerr << "MIT-SHM is not available." << std::endl;
+  }
+
+  xcb_disconnect(connection);
+  return 0;
+}
@@ -93,7 +93,7 @@ uxdevice::window_service_xcb_t *uxdevice::window_service_xcb_t::get(void) {
         y = xcb->y;
         w = xcb->width;
         h = xcb->height;
-        alias = std::type_index{typeid(listen_paint_t)};
+        alias = event_id_t::paint;
       },
 
       /**
@@ -109,7 +109,7 @@ uxdevice::window_service_xcb_t *uxdevice::window_service_xcb_t::get(void) {
           h = xcb->height;
 
           bvideo_output = true;
-          alias = std::type_index{typeid(listen_resize_t)};
+          alias = event_id_t::resize;
         }
       },
 
@@ -121,10 +121,10 @@ uxdevice::window_service_xcb_t *uxdevice::window_service_xcb_t::get(void) {
       [&](client_message_xcb_t xcb) {
         // filter subset for this... original from stack over flow
         if (xcb->data.data32[0] == window_manager->reply2->atom) {
-          alias = std::type_index{typeid(listen_close_window_t)};
+          alias = event_id_t::close_window;
         }
       },
-      [&](std::monostate) { alias = std::type_index{typeid(std::monostate)}; }};
+      [&](std::monostate) { alias = event_id_t::none; }};
 
   std::visit(visit_map, data);
 
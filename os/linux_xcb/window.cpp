@@ -128,6 +128,8 @@ void uxdevice::os_xcb_linux_t::open_connection(void) {
   /// @brief set the base window manager's settings.
   screen_width = screen->width_in_pixels;
   screen_height = screen->height_in_pixels;
+
+  keysym_cache.attach(connection, xdisplay);
 }
 
 /**
@@ -147,6 +149,12 @@ void uxdevice::os_xcb_linux_t::close_connection(void) {
     window = 0;
   }
 
+  keysym_cache.detach();
+
+  for (auto e : shm_deferred)
+    free(e);
+  shm_deferred.clear();
+
   if (xdisplay) {
     XCloseDisplay(xdisplay);
     xdisplay = nullptr;
@@ -201,6 +209,28 @@ void uxdevice::os_xcb_linux_t::fn_open_window(void) {
                       4, 32, 1, &(*reply2).atom);
 }
 
+/**
+ * @internal
+ * @class shm_segment_t
+ * @brief the shared memory behind an image surface. It is attached to the
+ * surface as user data and released when cairo destroys the surface.
+ */
+class shm_segment_t {
+public:
+  xcb_connection_t *connection = {};
+  xcb_shm_seg_t seg = {};
+  void *addr = {};
+};
+
+static cairo_user_data_key_t shm_segment_key = {};
+
+static void shm_segment_destroy(void *data) {
+  auto segment = static_cast<shm_segment_t *>(data);
+  xcb_shm_detach(segment->connection, segment->seg);
+  shmdt(segment->addr);
+  delete segment;
+}
+
 /**
  * @internal
  * @fn allocate_surface
@@ -210,7 +240,9 @@ void uxdevice::os_xcb_linux_t::fn_open_window(void) {
  * hence the name of the function "allocate".
  *
  * Create xcb surface,
- * Here the cairo_xcb_surface_create specific function is used.
+ * Here the cairo_xcb_surface_create specific function is used unless a client
+ * memory presentation is requested. Those need a 24 or 32 bit visual to share
+ * the pixel layout of a CAIRO_FORMAT_RGB24 image.
  *
  */
 cairo_surface_t *uxdevice::os_xcb_linux_t::fn_allocate_surface(void) {
@@ -226,13 +258,95 @@ cairo_surface_t *uxdevice::os_xcb_linux_t::fn_allocate_surface(void) {
     for (; visual_iter.rem; xcb_visualtype_next(&visual_iter)) {
       if (screen->root_visual == visual_iter.data->visual_id) {
         visual_type = visual_iter.data;
+        visual_depth = depth_iter.data->depth;
         break;
       }
     }
   }
 
-  return cairo_xcb_surface_create(connection, window, visual_type,
-                                       window_width, window_height));
+  if (visual_depth != 24 && visual_depth != 32)
+    presentation = presentation_t::xcb_surface;
+
+  if (presentation == presentation_t::shm_image && !shm_available())
+    presentation = presentation_t::put_image;
+
+  if (presentation == presentation_t::xcb_surface)
+    return cairo_xcb_surface_create(connection, window, visual_type,
+                                    window_width, window_height);
+
+  return image_surface_create(window_width, window_height);
+}
+
+/**
+ * @internal
+ * @fn shm_available
+ * @brief the MIT-SHM extension is present on the server. Shared memory only
+ * works for a local server which the attach in image_surface_create tests.
+ */
+bool uxdevice::os_xcb_linux_t::shm_available(void) {
+  const xcb_query_extension_reply_t *ext =
+      xcb_get_extension_data(connection, &xcb_shm_id);
+  if (!ext || !ext->present)
+    return false;
+
+  xcb_shm_query_version_reply_t *version = xcb_shm_query_version_reply(
+      connection, xcb_shm_query_version(connection), nullptr);
+  if (!version)
+    return false;
+
+  free(version);
+  shm_completion_event =
+      static_cast<std::uint8_t>(ext->first_event + XCB_SHM_COMPLETION);
+  return true;
+}
+
+/**
+ * @internal
+ * @fn image_surface_create
+ * @param const int w
+ * @param const int h
+ * @brief creates the client memory surface. For shm_image a SysV segment is
+ * attached to the server. The segment is marked for removal at once so it is
+ * freed when both sides detach, even if the process ends abruptly. When any
+ * step fails the mode becomes put_image and cairo allocates the pixels.
+ */
+cairo_surface_t *uxdevice::os_xcb_linux_t::image_surface_create(const int w,
+                                                                const int h) {
+  int width = std::max(w, 1);
+  int height = std::max(h, 1);
+  int stride = cairo_format_stride_for_width(CAIRO_FORMAT_RGB24, width);
+
+  if (presentation == presentation_t::shm_image) {
+    int shmid = shmget(IPC_PRIVATE, static_cast<std::size_t>(stride) * height,
+                       IPC_CREAT | 0600);
+    void *addr = shmid == -1 ? nullptr : shmat(shmid, nullptr, 0);
+
+    if (addr && addr != reinterpret_cast<void *>(-1)) {
+      xcb_shm_seg_t seg = xcb_generate_id(connection);
+      xcb_generic_error_t *error = xcb_request_check(
+          connection, xcb_shm_attach_checked(connection, seg, shmid, 0));
+      shmctl(shmid, IPC_RMID, nullptr);
+
+      if (!error) {
+        cairo_surface_t *s = cairo_image_surface_create_for_data(
+            static_cast<unsigned char *>(addr), CAIRO_FORMAT_RGB24, width,
+            height, stride);
+        cairo_surface_set_user_data(
+            s, &shm_segment_key, new shm_segment_t{connection, seg, addr},
+            shm_segment_destroy);
+        return s;
+      }
+
+      free(error);
+      shmdt(addr);
+    } else if (shmid != -1) {
+      shmctl(shmid, IPC_RMID, nullptr);
+    }
+
+    presentation = presentation_t::put_image;
+  }
+
+  return cairo_image_surface_create(CAIRO_FORMAT_RGB24, width, height);
 }
 
 /**
@@ -241,11 +355,155 @@ cairo_surface_t *uxdevice::os_xcb_linux_t::fn_allocate_surface(void) {
  * @brief the function provides the size change of the surface which is an os
  * dependent function. This function is called from a multitasking point which
  * the base class manages the locking on the read and write of this object
- * specifically.
+ * specifically. An image surface is replaced by one of the new size.
+ */
+cairo_surface_t *uxdevice::os_xcb_linux_t::fn_resize_surface(
+    cairo_surface_t *_s, const int w, const int h) {
+  if (presentation == presentation_t::xcb_surface) {
+    cairo_xcb_surface_set_size(_s, w, h);
+    return _s;
+  }
+
+  return image_surface_create(w, h);
+}
+
+/**
+ * @internal
+ * @fn fn_present_surface
+ * @brief copies the area from the image surface to the window. The shared
+ * memory path sends only the request and asks for a completion event, as
+ * the server reads the pixels later. fn_acquire_surface waits for it before
+ * the segment is drawn again. The put_image path sends the pixels of whole
+ * rows, split to fit the maximum request length.
+ */
+void uxdevice::os_xcb_linux_t::fn_present_surface(cairo_surface_t *_s,
+                                                  const int x, const int y,
+                                                  const int w, const int h) {
+  if (presentation == presentation_t::xcb_surface)
+    return;
+
+  int sw = cairo_image_surface_get_width(_s);
+  int sh = cairo_image_surface_get_height(_s);
+  int x1 = std::clamp(x, 0, sw), y1 = std::clamp(y, 0, sh);
+  int x2 = std::clamp(x + w, 0, sw), y2 = std::clamp(y + h, 0, sh);
+  if (x1 >= x2 || y1 >= y2)
+    return;
+
+  auto segment = static_cast<shm_segment_t *>(
+      cairo_surface_get_user_data(_s, &shm_segment_key));
+
+  if (segment) {
+    shm_pending++;
+    xcb_shm_put_image(connection, window, graphics, sw, sh, x1, y1, x2 - x1,
+                      y2 - y1, x1, y1, visual_depth,
+                      XCB_IMAGE_FORMAT_Z_PIXMAP, 1, segment->seg, 0);
+    return;
+  }
+
+  unsigned char *data = cairo_image_surface_get_data(_s);
+  int stride = cairo_image_surface_get_stride(_s);
+
+  /// @brief request length is in four byte units, less the request header.
+  std::size_t max_bytes =
+      static_cast<std::size_t>(xcb_get_maximum_request_length(connection)) *
+          4 -
+      sizeof(xcb_put_image_request_t);
+  int rows = std::max(1, static_cast<int>(max_bytes / stride));
+
+  for (int row = y1; row < y2; row += rows) {
+    int count = std::min(rows, y2 - row);
+    xcb_put_image(connection, XCB_IMAGE_FORMAT_Z_PIXMAP, window, graphics, sw,
+                  count, 0, row, 0, visual_depth, count * stride,
+                  data + row * stride);
+  }
+}
+
+/**
+ * @internal
+ * @fn fn_acquire_surface
+ * @brief waits until the server has read every presented area of the shared
+ * segment so that drawing does not change pixels still being copied. When
+ * no completion arrives within shm_completion_timeout the count is dropped
+ * so a stalled event thread cannot stop the render. In reactor mode the
+ * connection is read here instead, see shm_pump.
+ */
+void uxdevice::os_xcb_linux_t::fn_acquire_surface(cairo_surface_t *_s) {
+  if (shm_pending.load(std::memory_order_acquire) == 0)
+    return;
+
+  xcb_flush(connection);
+
+  /// @brief the reactor thread is also the one that dispatches, nothing
+  /// else would read the completion.
+  if (threading == message_threading_t::reactor) {
+    shm_pump();
+    return;
+  }
+
+  std::unique_lock lock(shm_pending_mutex);
+  if (!shm_pending_cv.wait_for(lock, shm_completion_timeout,
+                               [&]() { return shm_pending.load() <= 0; }))
+    shm_pending = 0;
+}
+
+/**
+ * @internal
+ * @fn shm_pump
+ * @brief reads the connection on the reactor thread until the put requests
+ * complete or shm_completion_timeout passes. Other events read meanwhile are
+ * kept in shm_deferred, in order, and returned first by fn_poll_message and
+ * fn_read_message. The reactor takes them before it waits again.
+ */
+void uxdevice::os_xcb_linux_t::shm_pump(void) {
+  auto due = std::chrono::steady_clock::now() + shm_completion_timeout;
+  pollfd p = {xcb_get_file_descriptor(connection), POLLIN, 0};
+
+  while (shm_pending.load() > 0 && !xcb_connection_has_error(connection)) {
+    xcb_generic_event_t *e = xcb_poll_for_event(connection);
+
+    if (!e) {
+      auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+          due - std::chrono::steady_clock::now());
+      if (remaining.count() <= 0)
+        break;
+      poll(&p, 1, static_cast<int>(remaining.count()) + 1);
+      continue;
+    }
+
+    if ((e->response_type & ~0x80) == shm_completion_event) {
+      shm_completion();
+      free(e);
+    } else {
+      shm_deferred.emplace_back(e);
+    }
+  }
+
+  shm_pending = 0;
+}
+
+/**
+ * @internal
+ * @fn shm_deferred_next
+ * @brief removes and returns the oldest event read by shm_pump.
+ */
+xcb_generic_event_t *uxdevice::os_xcb_linux_t::shm_deferred_next(void) {
+  xcb_generic_event_t *e = shm_deferred.front();
+  shm_deferred.pop_front();
+  return e;
+}
+
+/**
+ * @internal
+ * @fn shm_completion
+ * @brief the server finished reading the segment for one put request.
  */
-uxdevice::os_xcb_linux_t::fn_resize_surface(cairo_surface_t *_s, const int w,
-                                            const int h) {
-  cairo_xcb_surface_set_size(_s, w, h);
+void uxdevice::os_xcb_linux_t::shm_completion(void) {
+  {
+    std::lock_guard lock(shm_pending_mutex);
+    if (shm_pending > 0)
+      shm_pending--;
+  }
+  shm_pending_cv.notify_all();
 }
 
 /**
@@ -287,9 +545,34 @@ xcb_generic_event_t *uxdevice::os_xcb_linux_t::fn_wait_message(void) {
  *
  */
 xcb_generic_event_t *uxdevice::os_xcb_linux_t::fn_poll_message(void) {
+  if (!shm_deferred.empty())
+    return shm_deferred_next();
   return xcb_poll_for_queued_event(connection);
 }
 
+/**
+ * @internal
+ * @fn fn_read_message(void)
+ * @brief reads the connection without blocking. Called from the reactor
+ * when the connection descriptor is readable.
+ * @return xcb_generic_event_t *
+ */
+xcb_generic_event_t *uxdevice::os_xcb_linux_t::fn_read_message(void) {
+  if (!shm_deferred.empty())
+    return shm_deferred_next();
+  return xcb_poll_for_event(connection);
+}
+
+/**
+ * @internal
+ * @fn fn_message_descriptor(void)
+ * @brief the socket of the xcb connection.
+ * @return int
+ */
+int uxdevice::os_xcb_linux_t::fn_message_descriptor(void) {
+  return xcb_get_file_descriptor(connection);
+}
+
 /**
  * @internal
  * @fn complete_message(xcb_generic_event_t *xcb)
@@ -302,47 +585,164 @@ voiduxdevice::os_xcb_linux_t::fn_complete_message(xcb_generic_event_t *xcb) {
 
 /**
  * @internal
- * @var message_dispatch_t
- * @brief translates between system domain.
- * generic_os_event_queue_message_t is defined in compile options as it is
- * associated with os compile target. It is defined as a static so only one
- * exists in all versions of the window object.
+ * @fn fn_coalesce_messages
+ * @param std::deque<xcb_generic_event_t *> &batch
+ * @brief merges events within the batch which later ones supersede.
+ *  - a run of pointer motion for a window keeps the latest.
+ *  - an expose series, counted down to zero by the server, becomes its last
+ *    event holding the union of the rectangles. A series still open at the
+ *    end of the batch is given as far as it was received.
+ *  - only the last configure notify of a window is kept.
+ * Removed events are freed here.
  */
-void uxdevice::os_xcb_linux_t::fn_visit_dispatch(xcb_generic_event_t *xcb) {
-  static const message_dispatch_t message_dispatch = {
-      {XCB_KEY_PRESS,
-       [&]() { dispatch<keyboard_device_xcb_t, key_press_xcb_t>(xcb); }},
+void uxdevice::os_xcb_linux_t::fn_coalesce_messages(
+    std::deque<xcb_generic_event_t *> &batch) {
+  std::deque<xcb_generic_event_t *> kept = {};
+  std::unordered_map<xcb_window_t, std::size_t> last_configure = {};
+
+  for (std::size_t i = 0; i < batch.size(); i++)
+    if ((batch[i]->response_type & ~0x80) == XCB_CONFIGURE_NOTIFY)
+      last_configure[reinterpret_cast<xcb_configure_notify_event_t *>(
+                         batch[i])
+                         ->window] = i;
+
+  xcb_expose_event_t *series = {};
+  int x1 = {}, y1 = {}, x2 = {}, y2 = {};
+
+  for (std::size_t i = 0; i < batch.size(); i++) {
+    xcb_generic_event_t *e = batch[i];
+    auto type = e->response_type & ~0x80;
+    xcb_generic_event_t *next = i + 1 < batch.size() ? batch[i + 1] : nullptr;
+
+    if (type == XCB_MOTION_NOTIFY && next &&
+        (next->response_type & ~0x80) == XCB_MOTION_NOTIFY &&
+        reinterpret_cast<xcb_motion_notify_event_t *>(next)->event ==
+            reinterpret_cast<xcb_motion_notify_event_t *>(e)->event) {
+      free(e);
+      coalesce_counters.motion++;
+      continue;
+    }
+
+    if (type == XCB_CONFIGURE_NOTIFY &&
+        last_configure[reinterpret_cast<xcb_configure_notify_event_t *>(e)
+                           ->window] != i) {
+      free(e);
+      coalesce_counters.configure++;
+      continue;
+    }
+
+    if (type == XCB_EXPOSE) {
+      auto expose = reinterpret_cast<xcb_expose_event_t *>(e);
 
-      {XCB_KEY_RELEASE,
-       [&]() { dispatch<keyboard_device_xcb_t, key_release_xcb_t>(xcb); }},
+      if (series && series->window != expose->window) {
+        kept.emplace_back(reinterpret_cast<xcb_generic_event_t *>(series));
+        series = nullptr;
+      }
 
-      {XCB_BUTTON_PRESS,
-       [&]() { dispatch<mouse_device_xcb_t, button_press_xcb_t>(xcb); }},
+      if (!series) {
+        x1 = expose->x;
+        y1 = expose->y;
+        x2 = expose->x + expose->width;
+        y2 = expose->y + expose->height;
+      } else {
+        x1 = std::min(x1, static_cast<int>(expose->x));
+        y1 = std::min(y1, static_cast<int>(expose->y));
+        x2 = std::max(x2, expose->x + expose->width);
+        y2 = std::max(y2, expose->y + expose->height);
+        free(series);
+        coalesce_counters.expose++;
+      }
 
-      {XCB_BUTTON_RELEASE,
-       [&]() { dispatch<mouse_device_xcb_t, button_release_xcb_t>(xcb); }},
+      series = expose;
+      series->x = static_cast<uint16_t>(x1);
+      series->y = static_cast<uint16_t>(y1);
+      series->width = static_cast<uint16_t>(x2 - x1);
+      series->height = static_cast<uint16_t>(y2 - y1);
 
-      {XCB_MOTION_NOTIFY,
-       [&]() { dispatch<mouse_device_xcb_t, motion_notify_xcb_t>(xcb); }},
+      if (expose->count == 0) {
+        kept.emplace_back(e);
+        series = nullptr;
+      }
+      continue;
+    }
 
-      {XCB_EXPOSE,
-       [&]() { dispatch<window_service_xcb_t, surface_expose_xcb_t>(xcb); }},
+    kept.emplace_back(e);
+  }
+
+  if (series)
+    kept.emplace_back(reinterpret_cast<xcb_generic_event_t *>(series));
+
+  batch.swap(kept);
+}
+
+/**
+ * @internal
+ * @fn message_dispatch_table
+ * @brief builds the dispatch table at compile time. Each entry is a plain
+ * function pointer so that a dispatch is one index and one call, with no
+ * hashing and no captured state.
+ */
+constexpr std::array<uxdevice::os_xcb_linux_t::message_dispatch_fn_t, 128>
+uxdevice::os_xcb_linux_t::message_dispatch_table(void) {
+  std::array<message_dispatch_fn_t, 128> t = {};
+
+  t[XCB_KEY_PRESS] = &keyboard_dispatch_fn<key_press_xcb_t>;
+  t[XCB_KEY_RELEASE] = &keyboard_dispatch_fn<key_release_xcb_t>;
+  t[XCB_MAPPING_NOTIFY] = &mapping_notify_fn;
+
+  t[XCB_BUTTON_PRESS] = &dispatch_fn<mouse_device_xcb_t, button_press_xcb_t>;
+  t[XCB_BUTTON_RELEASE] =
+      &dispatch_fn<mouse_device_xcb_t, button_release_xcb_t>;
+  t[XCB_MOTION_NOTIFY] = &dispatch_fn<mouse_device_xcb_t, motion_notify_xcb_t>;
+
+  t[XCB_EXPOSE] = &dispatch_fn<window_service_xcb_t, surface_expose_xcb_t>;
+  t[XCB_CONFIGURE_NOTIFY] =
+      &dispatch_fn<window_service_xcb_t, configure_notify_xcb_t>;
+  t[XCB_CLIENT_MESSAGE] =
+      &dispatch_fn<window_service_xcb_t, client_message_xcb_t>;
+
+  return t;
+}
 
-      {XCB_CONFIGURE_NOTIFY,
-       [&]() { dispatch<window_service_xcb_t, configure_notify_xcb_t>(xcb); }},
+/**
+ * @internal
+ * @fn mapping_notify_fn
+ * @brief the keyboard mapping changed, cached key translations are dropped.
+ */
+void uxdevice::os_xcb_linux_t::mapping_notify_fn(os_xcb_linux_t *wm,
+                                                 xcb_generic_event_t *xcb) {
+  auto e = reinterpret_cast<xcb_mapping_notify_event_t *>(xcb);
+  if (e->request == XCB_MAPPING_KEYBOARD ||
+      e->request == XCB_MAPPING_MODIFIER)
+    wm->keysym_cache.mapping_notify(e);
+}
 
-      {XCB_CLIENT_MESSAGE,
-       [&]() { dispatch<window_service_xcb_t, client_message_xcb_t>(xcb); }}
+/**
+ * @internal
+ * @var message_dispatch
+ * @brief translates between system domain. It is defined as a static so only
+ * one exists in all versions of the window object.
+ */
+const std::array<uxdevice::os_xcb_linux_t::message_dispatch_fn_t, 128>
+    uxdevice::os_xcb_linux_t::message_dispatch = message_dispatch_table();
 
-  };
+/**
+ * @internal
+ * @fn fn_visit_dispatch
+ * @param xcb_generic_event_t *xcb
+ * @brief event codes are below 128 once the sent event bit is removed. The
+ * entry invocation performs a dispatch using the std::visit function.
+ */
+void uxdevice::os_xcb_linux_t::fn_visit_dispatch(xcb_generic_event_t *xcb) {
+  auto type = xcb->response_type & ~0x80;
+  if (shm_completion_event && type == shm_completion_event) {
+    shm_completion();
+    return;
+  }
 
-  /** @brief process, depending upon filter, non handled messages may be
-   * faster with a bit range check. this can be enhanced with specific
-   * numerical representation. xcb internals possibly. The it->second()
-   * invocation performs a dispatch using the std::visit function. */
-  auto it = message_dispatch.find(xcb->response_type & ~0x80);
-  if (it != message_dispatch.end())
-    it->second();
+  auto fn = message_dispatch[type];
+  if (fn)
+    fn(this, xcb);
 }
 
 /**
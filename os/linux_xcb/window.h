@@ -72,17 +72,41 @@ public:
   void fn_close_window(void);
   void fn_flush_window(void);
 
+  cairo_surface_t *fn_allocate_surface(void);
+  cairo_surface_t *fn_resize_surface(cairo_surface_t *_s, const int w,
+                                     const int h);
+  void fn_present_surface(cairo_surface_t *_s, const int x, const int y,
+                          const int w, const int h);
+  void fn_acquire_surface(cairo_surface_t *_s);
+
+  /**
+   * @enum presentation_t
+   * @brief how frames reach the window. xcb_surface draws through the X
+   * protocol. shm_image draws into client memory shared with the server
+   * and copies the changed areas with xcb_shm_put_image. put_image is the
+   * same without shared memory, used when the server is remote or lacks the
+   * MIT-SHM extension.
+   */
+  enum class presentation_t { xcb_surface, shm_image, put_image };
+
+  /// @brief the requested mode, set before the window opens. The mode in
+  /// use is lowered when the server does not support it.
+  presentation_t presentation = presentation_t::shm_image;
+
   /// @brief the base window manager has a threaded event queue and a variant
   /// visit interface. These functions are called by this logic. The odd ball,
   /// fn_complete_message is a free(). This routine is called when the system
   /// completes processing of the message.
   xcb_generic_event_t *fn_wait_message(void);
   xcb_generic_event_t *fn_poll_message(void);
+  xcb_generic_event_t *fn_read_message(void);
+  int fn_message_descriptor(void);
   void fn_complete_message(xcb_generic_event_t *);
 
   /// @brief the composition of the event and its logic causing invocation of
   /// event listeners attached.
   void fn_visit_dispatch(xcb_generic_event_t *e);
+  void fn_coalesce_messages(std::deque<xcb_generic_event_t *> &batch);
 
   /// @brief window attributes
   void fn_set_title(const std::string &s);
@@ -94,6 +118,56 @@ private:
   xcb_drawable_t window = {};
   xcb_gcontext_t graphics = {};
   xcb_visualtype_t *visual_type = {};
+  std::uint8_t visual_depth = {};
+
+  cairo_surface_t *image_surface_create(const int w, const int h);
+  bool shm_available(void);
+
+  /// @brief xcb_shm_put_image requests the server has not finished reading.
+  /// Each is answered by a completion event, whose code is the extension's
+  /// first event, zero when MIT-SHM is absent. Drawing into the segment
+  /// waits for the count to reach zero, at most shm_completion_timeout in
+  /// case the events are not being read.
+  std::uint8_t shm_completion_event = {};
+  std::atomic<int> shm_pending = {};
+  std::mutex shm_pending_mutex = {};
+  std::condition_variable shm_pending_cv = {};
+  static constexpr std::chrono::milliseconds shm_completion_timeout =
+      std::chrono::milliseconds(100);
+  void shm_completion(void);
+
+  /// @brief events read while pumping for completions in reactor mode.
+  /// Used by the reactor thread only.
+  std::deque<xcb_generic_event_t *> shm_deferred = {};
+  void shm_pump(void);
+  xcb_generic_event_t *shm_deferred_next(void);
+
+  /// @brief dispatch table indexed by the event code, response_type without
+  /// the sent event bit. Entries are null for events not handled.
+  using message_dispatch_fn_t = void (*)(os_xcb_linux_t *,
+                                         xcb_generic_event_t *);
+  static const std::array<message_dispatch_fn_t, 128> message_dispatch;
+
+  template <typename DEVICE, typename MSG_CLASS>
+  static void dispatch_fn(os_xcb_linux_t *wm, xcb_generic_event_t *xcb) {
+    wm->dispatch<DEVICE, MSG_CLASS>(xcb);
+  }
+
+  /// @brief key events are translated through the keysym cache.
+  template <typename MSG_CLASS>
+  static void keyboard_dispatch_fn(os_xcb_linux_t *wm,
+                                   xcb_generic_event_t *xcb) {
+    auto o = keyboard_device_xcb_t{&wm->keysym_cache, MSG_CLASS{xcb}};
+    auto evt = o.get();
+    wm->dispatch_event(evt);
+  }
+
+  static void mapping_notify_fn(os_xcb_linux_t *wm, xcb_generic_event_t *xcb);
+
+  keysym_cache_t keysym_cache = {};
+
+  static constexpr std::array<message_dispatch_fn_t, 128>
+  message_dispatch_table(void);
 
   /// @brief wm_close message enable
   xcb_intern_atom_cookie_t cookie = {};